@@ -4,7 +4,10 @@ CONFIG += ordered
 
 SUBDIRS += \
     core \
+    sim \
+    replay \
     tests \
+    bench \
 
 OTHER_FILES += \
     defaults.pri
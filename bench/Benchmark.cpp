@@ -0,0 +1,130 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace labyrinth { namespace bench {
+
+typedef std::chrono::steady_clock Clock;
+
+static double time(const BenchmarkRunner::Operation &operation,
+                   unsigned long long iterations)
+{
+    auto start = Clock::now();
+    for (unsigned long long i = 0; i < iterations; ++i) {
+        operation();
+    }
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    return elapsed.count();
+}
+
+BenchmarkResult BenchmarkRunner::measure(const std::string &name,
+                                         const Setup &setup) const
+{
+    Operation operation = setup();
+    unsigned long long iterations = 1;
+    double elapsed = time(operation, iterations);
+    while (elapsed < minSampleTime_) {
+        double factor = elapsed > 0 ? 1.5 * minSampleTime_ / elapsed : 10;
+        iterations = static_cast<unsigned long long>(iterations * std::min(factor, 10.0)) + 1;
+        elapsed = time(operation, iterations);
+    }
+    std::vector<double> samples{elapsed * 1e9 / iterations};
+    while (samples.size() < nbOfSamples_) {
+        samples.push_back(time(operation, iterations) * 1e9 / iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+    return BenchmarkResult{name, iterations, samples[samples.size() / 2], samples.front()};
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::run(const std::string &filter) const
+{
+    std::vector<BenchmarkResult> results;
+    for (const auto &benchmark : benchmarks_) {
+        if (benchmark.first.find(filter) != std::string::npos) {
+            results.push_back(measure(benchmark.first, benchmark.second));
+        }
+    }
+    return results;
+}
+
+void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &out)
+{
+    out << "{\n  \"benchmarks\": [\n" << std::fixed << std::setprecision(2);
+    for (unsigned i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+        out << "    {\"name\": \"" << result.name << "\", \"iterations\": "
+            << result.iterations << ", \"ns_per_op\": " << result.nanoseconds
+            << ", \"min_ns_per_op\": " << result.minNanoseconds << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+static std::string readString(const std::string &object, const std::string &key)
+{
+    std::string::size_type start = object.find("\"" + key + "\"");
+    if (start == std::string::npos) throw std::runtime_error("Missing " + key + ".");
+    start = object.find('"', object.find(':', start)) + 1;
+    return object.substr(start, object.find('"', start) - start);
+}
+
+static double readNumber(const std::string &object, const std::string &key)
+{
+    std::string::size_type start = object.find("\"" + key + "\"");
+    if (start == std::string::npos) throw std::runtime_error("Missing " + key + ".");
+    return std::stod(object.substr(object.find(':', start) + 1));
+}
+
+std::vector<BenchmarkResult> readJson(std::istream &in)
+{
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+    std::string::size_type start = text.find("\"benchmarks\"");
+    if (start == std::string::npos) {
+        throw std::runtime_error("Not a benchmark report.");
+    }
+    std::vector<BenchmarkResult> results;
+    while ((start = text.find('{', start)) != std::string::npos) {
+        std::string::size_type end = text.find('}', start);
+        std::string object = text.substr(start, end - start);
+        results.push_back(BenchmarkResult{
+                              readString(object, "name"),
+                              static_cast<unsigned long long>(readNumber(object, "iterations")),
+                              readNumber(object, "ns_per_op"),
+                              readNumber(object, "min_ns_per_op")});
+        start = end;
+    }
+    return results;
+}
+
+unsigned compare(const std::vector<BenchmarkResult> &baseline,
+                 const std::vector<BenchmarkResult> &results,
+                 double threshold, std::ostream &out)
+{
+    unsigned regressions = 0;
+    out << std::fixed << std::setprecision(2);
+    for (const BenchmarkResult &result : results) {
+        auto reference = std::find_if(baseline.begin(), baseline.end(),
+                                      [&](const BenchmarkResult &other) {
+            return other.name == result.name;
+        });
+        if (reference == baseline.end()) continue;
+        double change = 100.0 * (result.nanoseconds - reference->nanoseconds)
+                / reference->nanoseconds;
+        bool isRegression = change > threshold;
+        if (isRegression) ++regressions;
+        out << std::left << std::setw(40) << result.name << std::right
+            << std::setw(12) << reference->nanoseconds << " ns -> "
+            << std::setw(12) << result.nanoseconds << " ns "
+            << std::showpos << std::setw(9) << change << std::noshowpos << "%"
+            << (isRegression ? "  REGRESSION" : "") << '\n';
+    }
+    return regressions;
+}
+
+}}
@@ -0,0 +1,182 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace labyrinth { namespace bench {
+
+/**
+ * @brief Keeps the compiler from optimizing the computation of the given value
+ * away.
+ *
+ * @param value is the result of the measured operation.
+ */
+template<typename T>
+inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Is the measure of one benchmark.
+ */
+struct BenchmarkResult
+{
+
+    /**
+     * @brief Is the name of the benchmark.
+     */
+    std::string name;
+
+    /**
+     * @brief Is the number of operations of each sample.
+     */
+    unsigned long long iterations;
+
+    /**
+     * @brief Is the median duration of one operation over the samples, in
+     * nanoseconds.
+     */
+    double nanoseconds;
+
+    /**
+     * @brief Is the shortest duration of one operation over the samples, in
+     * nanoseconds.
+     */
+    double minNanoseconds;
+
+};
+
+/**
+ * @brief Runs the registered benchmarks.
+ *
+ * A benchmark is a setup function returning the operation to measure. The
+ * setup is not timed. The operation is repeated until a sample lasts at least
+ * the minimal duration, and several samples are taken so the median is stable.
+ */
+class BenchmarkRunner
+{
+
+public:
+
+    /**
+     * @brief Is the operation measured by a benchmark.
+     */
+    typedef std::function<void()> Operation;
+
+    /**
+     * @brief Is the setup of a benchmark, run once before its measure.
+     */
+    typedef std::function<Operation()> Setup;
+
+private:
+
+    /**
+     * @brief Are the registered benchmarks, by name.
+     */
+    std::vector<std::pair<std::string, Setup>> benchmarks_;
+
+    /**
+     * @brief Is the minimal duration of one sample, in seconds.
+     */
+    double minSampleTime_;
+
+    /**
+     * @brief Is the number of samples of each benchmark.
+     */
+    unsigned nbOfSamples_;
+
+public:
+
+    /**
+     * @brief Constructs a runner without benchmarks.
+     *
+     * @param minSampleTime is the minimal duration of one sample, in seconds.
+     * @param nbOfSamples is the number of samples of each benchmark.
+     */
+    BenchmarkRunner(double minSampleTime = 0.05, unsigned nbOfSamples = 7)
+        : minSampleTime_{minSampleTime},
+          nbOfSamples_{nbOfSamples}
+    {}
+
+    /**
+     * @brief Registers a benchmark.
+     *
+     * @param name is the unique name of the benchmark.
+     * @param setup builds the state of the benchmark and returns the operation
+     * to measure.
+     */
+    void add(const std::string &name, const Setup &setup) {
+        benchmarks_.emplace_back(name, setup);
+    }
+
+    /**
+     * @brief Runs the benchmarks whose name contains the given filter.
+     *
+     * @param filter is the text the names should contain, empty for all.
+     * @return the measures of the benchmarks, in registration order.
+     */
+    std::vector<BenchmarkResult> run(const std::string &filter = "") const;
+
+private:
+
+    /**
+     * @brief Measures one benchmark.
+     *
+     * @param name is the name of the benchmark.
+     * @param setup is the setup of the benchmark.
+     * @return the measure of the benchmark.
+     */
+    BenchmarkResult measure(const std::string &name, const Setup &setup) const;
+
+};
+
+/**
+ * @brief Writes the given results as JSON.
+ *
+ * @param results are the results to write.
+ * @param out is the stream to write to.
+ */
+void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &out);
+
+/**
+ * @brief Reads results written by writeJson.
+ *
+ * @param in is the stream to read from.
+ * @return the results read.
+ * @throws std::runtime_error if the stream is not a benchmark report.
+ */
+std::vector<BenchmarkResult> readJson(std::istream &in);
+
+/**
+ * @brief Compares the given results to a baseline and prints one line per
+ * benchmark present in both.
+ *
+ * @param baseline are the reference results.
+ * @param results are the new results.
+ * @param threshold is the slowdown, in percent, above which a benchmark is a
+ * regression.
+ * @param out is the stream to print the comparison to.
+ * @return the number of regressions.
+ */
+unsigned compare(const std::vector<BenchmarkResult> &baseline,
+                 const std::vector<BenchmarkResult> &results,
+                 double threshold, std::ostream &out);
+
+/**
+ * @brief Registers the benchmarks of the model hot paths.
+ *
+ * @param runner is the runner to register the benchmarks to.
+ */
+void addModelBenchmarks(BenchmarkRunner &runner);
+
+}}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,79 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Benchmark.h"
+
+using namespace labyrinth::bench;
+
+static const char *usage =
+        "usage: ./labyrinth-bench [--filter text] [--min-time ms] [--samples n]"
+        " [--out file.json] [--compare baseline.json] [--threshold percent]\n";
+
+/**
+ * @brief Runs the benchmarks of the model, writes their results as JSON and
+ * optionally compares them to a baseline. The exit status is 3 if a benchmark
+ * regressed.
+ */
+int main(int argc, char **argv) {
+
+    std::string filter;
+    std::string outPath;
+    std::string baselinePath;
+    double minTime = 50;
+    unsigned nbOfSamples = 7;
+    double threshold = 10;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (i + 1 == argc) throw std::invalid_argument(option);
+            std::string value = argv[++i];
+            if (option == "--filter") {
+                filter = value;
+            } else if (option == "--min-time") {
+                minTime = std::stod(value);
+            } else if (option == "--samples") {
+                nbOfSamples = std::stoul(value);
+            } else if (option == "--out") {
+                outPath = value;
+            } else if (option == "--compare") {
+                baselinePath = value;
+            } else if (option == "--threshold") {
+                threshold = std::stod(value);
+            } else {
+                throw std::invalid_argument(option);
+            }
+        }
+    } catch (const std::exception &) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    try {
+        BenchmarkRunner runner{minTime / 1000, nbOfSamples};
+        addModelBenchmarks(runner);
+        std::vector<BenchmarkResult> results = runner.run(filter);
+
+        if (outPath.empty()) {
+            writeJson(results, std::cout);
+        } else {
+            std::ofstream out{outPath};
+            writeJson(results, out);
+        }
+
+        if (!baselinePath.empty()) {
+            std::ifstream in{baselinePath};
+            if (!in) throw std::runtime_error("Cannot open " + baselinePath + ".");
+            unsigned regressions = compare(readJson(in), results, threshold, std::cerr);
+            if (regressions > 0) {
+                std::cerr << regressions << " benchmark(s) regressed by more than "
+                          << threshold << "%.\n";
+                return 3;
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include "Benchmark.h"
+
+#include <array>
+#include <memory>
+#include <streambuf>
+
+#include "Game.h"
+#include "Maze.h"
+#include "Output.h"
+#include "TurnSearcher.h"
+
+using namespace labyrinth::model;
+using namespace labyrinth::view;
+using namespace labyrinth::bot;
+
+namespace labyrinth { namespace bench {
+
+/**
+ * @brief Is the seed every benchmarked maze and game is set up from, so that
+ * two runs measure the same boards.
+ */
+static const unsigned SEED = 2019;
+
+/**
+ * @brief Discards everything written to it.
+ */
+class NullBuffer : public std::streambuf
+{
+
+protected:
+
+    int overflow(int c) override { return traits_type::not_eof(c); }
+
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+
+};
+
+static std::shared_ptr<Maze> makeMaze()
+{
+    RandomEngine engine{SEED};
+    return std::make_shared<Maze>(engine);
+}
+
+static std::shared_ptr<Game> makeGame()
+{
+    return std::make_shared<Game>(Game::MAX_NB_OF_PLAYERS, false, SEED);
+}
+
+static void addPathBenchmark(BenchmarkRunner &runner, const std::string &name,
+                             const MazePosition &from, const MazePosition &to)
+{
+    runner.add(name, [=]() {
+        std::shared_ptr<Maze> maze = makeMaze();
+        return [=]() { doNotOptimize(maze->existPathBetween(from, to)); };
+    });
+}
+
+static void addInsertionBenchmark(BenchmarkRunner &runner, const std::string &name,
+                                  const MazePosition &slot)
+{
+    runner.add(name, [=]() {
+        std::shared_ptr<Maze> maze = makeMaze();
+        return [=]() {
+            maze->insertLastPushedOutMazeCardAt(slot);
+            doNotOptimize(*maze);
+        };
+    });
+}
+
+void addModelBenchmarks(BenchmarkRunner &runner)
+{
+    const unsigned last = Maze::SIZE - 1;
+    addPathBenchmark(runner, "maze/existPathBetween/near",
+                     MazePosition{0, 0}, MazePosition{0, 1});
+    addPathBenchmark(runner, "maze/existPathBetween/far",
+                     MazePosition{0, 0}, MazePosition{last, last});
+
+    runner.add("maze/computeDistancesFrom", []() {
+        std::shared_ptr<Maze> maze = makeMaze();
+        std::shared_ptr<DistanceField> field = std::make_shared<DistanceField>();
+        return [=]() {
+            maze->computeDistancesFrom(MazePosition{0, 0}, *field);
+            doNotOptimize(*field);
+        };
+    });
+
+    runner.add("game/computePlayerDistances", []() {
+        std::shared_ptr<Game> game = makeGame();
+        std::shared_ptr<std::array<DistanceField, 4>> fields =
+                std::make_shared<std::array<DistanceField, 4>>();
+        return [=]() {
+            game->computePlayerDistances(fields->data());
+            doNotOptimize(*fields);
+        };
+    });
+
+    runner.add("maze/updateAdjacency", []() {
+        std::shared_ptr<Maze> maze = makeMaze();
+        return [=]() {
+            maze->updateAdjacency();
+            doNotOptimize(*maze);
+        };
+    });
+
+    addInsertionBenchmark(runner, "maze/insert/up", MazePosition{0, 1});
+    addInsertionBenchmark(runner, "maze/insert/right", MazePosition{1, last});
+    addInsertionBenchmark(runner, "maze/insert/down", MazePosition{last, 1});
+    addInsertionBenchmark(runner, "maze/insert/left", MazePosition{1, 0});
+
+    runner.add("game/movePathWays", []() {
+        std::shared_ptr<Game> game = makeGame();
+        game->getCurrentPlayer().setPosition(MazePosition{1, 3});
+        game->selectInsertionPosition(MazePosition{1, 0});
+        return [=]() {
+            game->movePathWays();
+            game->getCurrentPlayer().setWaiting();
+        };
+    });
+
+    runner.add("game/getObjectivePosition", []() {
+        std::shared_ptr<Game> game = makeGame();
+        Object objective = game->getCurrentPlayer().getObjective();
+        return [=]() { doNotOptimize(game->getObjectivePosition(objective)); };
+    });
+
+    runner.add("game/applyUndoTurn", []() {
+        std::shared_ptr<Game> game = makeGame();
+        Turn turn{MazePosition{1, 0}, 1, game->getCurrentPlayer().getPosition()};
+        return [=]() { game->undoTurn(game->applyTurn(turn)); };
+    });
+
+    runner.add("search/depth2", []() {
+        std::shared_ptr<Game> game = makeGame();
+        std::shared_ptr<TurnSearcher> searcher = std::make_shared<TurnSearcher>(SEED);
+        return [=]() { doNotOptimize(searcher->search(*game).score); };
+    });
+
+    runner.add("output/printMaze", []() {
+        std::shared_ptr<Game> game = makeGame();
+        std::shared_ptr<NullBuffer> buffer = std::make_shared<NullBuffer>();
+        std::shared_ptr<std::ostream> out = std::make_shared<std::ostream>(buffer.get());
+        std::shared_ptr<Output> output = std::make_shared<Output>(game.get(), *out);
+        // The game and the stream are captured to outlive the output using them.
+        return [game, buffer, out, output]() { output->printMaze(); };
+    });
+}
+
+}}
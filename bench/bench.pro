@@ -0,0 +1,46 @@
+include(../defaults.pri)
+
+TEMPLATE = app
+TARGET = labyrinth-bench
+CONFIG += console thread
+CONFIG -= qt
+
+SOURCES += \
+    Main.cpp \
+    Benchmark.cpp \
+    ModelBenchmarks.cpp \
+    ../core/model/DistanceField.cpp \
+    ../core/model/Game.cpp \
+    ../core/model/GameState.cpp \
+    ../core/model/Maze.cpp \
+    ../core/model/MoveGenerator.cpp \
+    ../core/model/MazeBitboard.cpp \
+    ../core/model/MazeCell.cpp \
+    ../core/model/MazeCard.cpp \
+    ../core/model/MazeCardsBuilder.cpp \
+    ../core/model/MazeCardShape.cpp \
+    ../core/model/MazePosition.cpp \
+    ../core/model/ObjectivesDeck.cpp \
+    ../core/model/Zobrist.cpp \
+    ../core/bot/TurnSearcher.cpp \
+    ../core/bot/Evaluator.cpp \
+    ../core/bot/WorkStealingPool.cpp \
+    ../core/view/console/Frame.cpp \
+    ../core/view/console/Output.cpp \
+    ../core/observer/Subject.cpp
+
+HEADERS += \
+    Benchmark.h \
+    ../core/bot/TurnSearcher.h \
+    ../core/bot/Evaluator.h \
+    ../core/bot/WorkStealingPool.h \
+    ../core/view/console/Frame.h \
+    ../core/view/console/Output.h
+
+DESTDIR = $$PWD/../build
+
+INCLUDEPATH += \
+    $$PWD \
+    ../core/model \
+    ../core/bot \
+    ../core/view/console
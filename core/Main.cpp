@@ -3,17 +3,45 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <algorithm>
+#include <cctype>
+#include <thread>
 
 #include "Game.h"
 #include "View.h"
 #include "Controller.h"
 #include "GameWindow.h"
+#include "GameServer.h"
 
 using namespace labyrinth::view;
 using namespace labyrinth::controller;
 using namespace labyrinth::model;
+using namespace labyrinth::server;
 
 static const char * option = "simplified";
+static const char * ansiOption = "ansi";
+static const unsigned short defaultPort = 4242;
+static const char * usage = "usage: ./labyrinth <-c, -g or -s> <number of players> [simplified] [ansi] [port]\n";
+
+/**
+ * @brief Reads the port of the server from the given argument, between 0 and
+ * 65535. Exits with the usage message otherwise.
+ */
+static unsigned short readPort(const char *argument)
+{
+    std::size_t length = 0;
+    unsigned long port = 0;
+    try {
+        port = std::stoul(argument, &length);
+    } catch (const std::exception &) {
+        length = 0;
+    }
+    if (length != std::strlen(argument) || port > 65535) {
+        std::cerr << usage << "the port should be a number between 0 and 65535.\n";
+        exit(1);
+    }
+    return static_cast<unsigned short>(port);
+}
 
 /**
  * @brief Start a game of Labyrinth.
@@ -21,11 +49,13 @@ static const char * option = "simplified";
 int main(int argc, char **argv) {
 
     if (argc < 3) {
-        std::cerr << "usage: ./labyrinth <-c or -g> <number of players> [simplified]\n";
+        std::cerr << usage;
         exit(1);
     }
 
     bool isSimplified = false;
+    bool isAnsi = false;
+    unsigned short port = defaultPort;
     unsigned nplayers = std::stoul(argv[2]);
 
     if (nplayers < Game::MIN_NB_OF_PLAYERS || Game::MAX_NB_OF_PLAYERS < nplayers) {
@@ -33,8 +63,28 @@ int main(int argc, char **argv) {
         exit(2);
     }
 
-    if (argc == 4 && std::strcmp(argv[3], option) == 0) {
-        isSimplified = true;
+    for (int arg = 3; arg < argc; ++arg) {
+        if (std::strcmp(argv[arg], option) == 0) {
+            isSimplified = true;
+        } else if (std::strcmp(argv[arg], ansiOption) == 0) {
+            isAnsi = true;
+        } else if (std::isdigit(static_cast<unsigned char>(argv[arg][0]))) {
+            port = readPort(argv[arg]);
+        }
+    }
+
+    if (std::strcmp(argv[1], "-s") == 0) {
+        try {
+            unsigned nbOfThreads = std::max(1u, std::thread::hardware_concurrency());
+            GameServer server{port, nbOfThreads, nplayers, isSimplified};
+            std::cout << "Serving games of " << nplayers << " players on port "
+                      << server.getPort() << "...\n";
+            server.run();
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << "\n";
+            return 3;
+        }
+        return 0;
     }
 
     Game game{nplayers, isSimplified};
@@ -47,7 +97,7 @@ int main(int argc, char **argv) {
         return core.exec();
     } else if (std::strcmp(argv[1], "-c") == 0) {
         try {
-            View view{&game};
+            View view{&game, isAnsi};
             Controller controller{view, &game};
             controller.start();
         } catch (const std::exception &e) {
@@ -0,0 +1,176 @@
+#include "Evaluator.h"
+#include "DistanceField.h"
+
+#include <algorithm>
+
+using namespace labyrinth::model;
+
+namespace labyrinth { namespace bot {
+
+constexpr int Evaluator::WIN;
+constexpr unsigned Evaluator::MAX_DISTANCE;
+
+/**
+ * @brief Is the maximum number of players of a game.
+ */
+static constexpr unsigned MAX_NB_OF_PLAYERS = 4;
+
+static unsigned getManhattanDistance(unsigned lhs, unsigned rhs)
+{
+    unsigned lhsRow = lhs / Maze::SIZE, rhsRow = rhs / Maze::SIZE;
+    unsigned lhsColumn = lhs % Maze::SIZE, rhsColumn = rhs % Maze::SIZE;
+    return (lhsRow < rhsRow ? rhsRow - lhsRow : lhsRow - rhsRow)
+            + (lhsColumn < rhsColumn ? rhsColumn - lhsColumn : lhsColumn - rhsColumn);
+}
+
+/**
+ * @brief Gets the cell of the target of the given player once he/ she found
+ * the given number of objectives, Maze::NO_CELL if it is on the spare card.
+ */
+static unsigned getTargetCell(const Maze &maze, const Player &player, unsigned nbOfFound)
+{
+    const ObjectivesDeck &objectives = player.getObjectives();
+    if (nbOfFound >= objectives.getNbOfCards()) {
+        return MazeBitboard::getCell(player.getInitialPosition());
+    }
+    Object object = objectives.getCard(nbOfFound).getObject();
+    return maze.isInside(object) ? maze.getObjectCell(object) : Maze::NO_CELL;
+}
+
+/**
+ * @brief Gets the features of the given player standing on the given cell.
+ *
+ * @param walk is the length of the shortest walk from the cell to the target,
+ * DistanceField::UNREACHABLE if there is none.
+ */
+static PlayerFeatures getFeatures(const Game &game, const Player &player, unsigned cell,
+                                  unsigned nbOfFound, unsigned target, unsigned walk,
+                                  unsigned mobility)
+{
+    PlayerFeatures features;
+    features.nbOfRemainingObjectives = player.getObjectives().getNbOfCards() - nbOfFound;
+    features.targetDistance = target == Maze::NO_CELL
+            ? Evaluator::MAX_DISTANCE
+            : std::min(walk, Maze::SIZE + getManhattanDistance(cell, target));
+    features.mobility = mobility;
+    features.hasWon = features.nbOfRemainingObjectives == 0
+            && (game.isSimplified()
+                || cell == MazeBitboard::getCell(player.getInitialPosition()));
+    return features;
+}
+
+/**
+ * @brief Gets the features of the given player from the distances of his/ her
+ * position. The walks are symmetric, so the field from the player tells the
+ * distance of the target.
+ */
+static PlayerFeatures getFeatures(const Game &game, const Maze &maze, const Player &player,
+                                  const MazePosition &position, const DistanceField &field)
+{
+    unsigned nbOfFound = player.getNbOfFoundObjectives();
+    unsigned target = getTargetCell(maze, player, nbOfFound);
+    return getFeatures(game, player, MazeBitboard::getCell(position), nbOfFound, target,
+                       target == Maze::NO_CELL ? 0 : field.getDistance(target),
+                       countCells(field.getReachable()));
+}
+
+PlayerFeatures Evaluator::getFeatures(const Game &game, unsigned player)
+{
+    const Player &scored = game.getPlayer(player);
+    DistanceField field;
+    game.getMaze().computeDistancesFrom(scored.getPosition(), field);
+    return bot::getFeatures(game, game.getMaze(), scored, scored.getPosition(), field);
+}
+
+int Evaluator::getProgress(const PlayerFeatures &features) const
+{
+    return -static_cast<int>(features.nbOfRemainingObjectives) * weights_.objective
+            - static_cast<int>(features.targetDistance) * weights_.distance
+            + static_cast<int>(features.mobility) * weights_.mobility;
+}
+
+int Evaluator::combine(const PlayerFeatures *features, unsigned nbOfPlayers,
+                       unsigned player) const
+{
+    for (unsigned index = 0; index < nbOfPlayers; ++index) {
+        if (features[index].hasWon) {
+            return index == player ? WIN : -WIN;
+        }
+    }
+    bool hasOthers = false;
+    int others = 0;
+    for (unsigned index = 0; index < nbOfPlayers; ++index) {
+        if (index == player) continue;
+        int progress = getProgress(features[index]);
+        others = hasOthers ? std::max(others, progress) : progress;
+        hasOthers = true;
+    }
+    return getProgress(features[player]) - weights_.opponents * others;
+}
+
+int Evaluator::evaluate(const Game &game, unsigned player) const
+{
+    PlayerFeatures features[MAX_NB_OF_PLAYERS];
+    unsigned nbOfPlayers = game.getNbOfPlayers();
+    for (unsigned index = 0; index < nbOfPlayers; ++index) {
+        features[index] = getFeatures(game, index);
+    }
+    return combine(features, nbOfPlayers, player);
+}
+
+void Evaluator::evaluate(const Game &game, const MoveGenerator &generator,
+                         unsigned player, std::vector<int> &scores) const
+{
+    const std::vector<MoveGenerator::Move> &moves = generator.getMoves();
+    scores.clear();
+    scores.reserve(moves.size());
+    const unsigned nbOfPlayers = game.getNbOfPlayers();
+    const unsigned current = game.getCurrentPlayerIndex();
+    const Player &moving = game.getPlayer(current);
+    const unsigned nbOfFound = moving.getNbOfFoundObjectives();
+    const bool isCollecting = !moving.hasFoundAllObjectives();
+
+    // The fields of the other players are from their positions, the 2 last
+    // ones are from the target of the current player and from his/ her next
+    // target, if the current one is found on the way.
+    const unsigned TARGET = MAX_NB_OF_PLAYERS;
+    const unsigned NEXT_TARGET = MAX_NB_OF_PLAYERS + 1;
+    DistanceField fields[MAX_NB_OF_PLAYERS + 2];
+    Bitboard sources[MAX_NB_OF_PLAYERS + 2] = {};
+    PlayerFeatures features[MAX_NB_OF_PLAYERS];
+    unsigned target = Maze::NO_CELL;
+    unsigned nextTarget = Maze::NO_CELL;
+    unsigned shiftIndex = static_cast<unsigned>(generator.getShifts().size());
+    for (const MoveGenerator::Move &move : moves) {
+        const MoveGenerator::Shift &shift = generator.getShiftOf(move);
+        if (move.shift != shiftIndex) {
+            shiftIndex = move.shift;
+            const Maze &maze = shift.maze;
+            for (unsigned index = 0; index < nbOfPlayers; ++index) {
+                sources[index] = index == current ? 0 : MazeBitboard::getBit(
+                        MazeBitboard::getCell(shift.playerPositions[index]));
+            }
+            target = getTargetCell(maze, moving, nbOfFound);
+            nextTarget = isCollecting && target != Maze::NO_CELL
+                    ? getTargetCell(maze, moving, nbOfFound + 1) : Maze::NO_CELL;
+            sources[TARGET] = target == Maze::NO_CELL ? 0 : MazeBitboard::getBit(target);
+            sources[NEXT_TARGET] = nextTarget == Maze::NO_CELL ? 0 : MazeBitboard::getBit(nextTarget);
+            DistanceField::compute(maze.getPathways(), sources, fields, NEXT_TARGET + 1);
+            for (unsigned index = 0; index < nbOfPlayers; ++index) {
+                if (index == current) continue;
+                features[index] = bot::getFeatures(game, maze, game.getPlayer(index),
+                                                   shift.playerPositions[index], fields[index]);
+            }
+        }
+        unsigned cell = MazeBitboard::getCell(move.turn.destination);
+        bool hasFound = isCollecting && cell == target;
+        features[current] = bot::getFeatures(
+                    game, moving, cell, nbOfFound + (hasFound ? 1 : 0),
+                    hasFound ? nextTarget : target,
+                    fields[hasFound ? NEXT_TARGET : TARGET].getDistance(cell),
+                    shift.destinations.size());
+        scores.push_back(combine(features, nbOfPlayers, player));
+    }
+}
+
+}}
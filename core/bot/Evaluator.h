@@ -0,0 +1,168 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include <vector>
+
+#include "Game.h"
+#include "MoveGenerator.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Are the weights of the features of a player scored by an Evaluator.
+ */
+struct EvaluationWeights
+{
+
+    /**
+     * @brief Is the cost of each objective left to find. It should be above
+     * distance times Evaluator::MAX_DISTANCE, so that finding an objective is
+     * worth more than any move.
+     */
+    int objective = 4 * static_cast<int>(model::Maze::SIZE);
+
+    /**
+     * @brief Is the cost of each step between the player and his/ her target.
+     */
+    int distance = 1;
+
+    /**
+     * @brief Is the value of each cell the player can walk to.
+     */
+    int mobility = 0;
+
+    /**
+     * @brief Is the weight of the best progress of the other players, 0 to
+     * ignore them.
+     */
+    int opponents = 1;
+
+};
+
+/**
+ * @brief Are the features of a player in a game.
+ */
+struct PlayerFeatures
+{
+
+    /**
+     * @brief Is the number of objectives the player has still to find.
+     */
+    unsigned nbOfRemainingObjectives;
+
+    /**
+     * @brief Is the number of steps between the player and his/ her target,
+     * the current objective or the initial position once they are all found.
+     * It is never above Evaluator::MAX_DISTANCE.
+     */
+    unsigned targetDistance;
+
+    /**
+     * @brief Is the number of cells the player can walk to, his/ her own
+     * included.
+     */
+    unsigned mobility;
+
+    /**
+     * @brief Tells if the player has won.
+     */
+    bool hasWon;
+
+};
+
+/**
+ * @brief Scores games for a player as a weighted sum of the features of the
+ * players (see EvaluationWeights). The score is the progress of the player
+ * minus the weighted best progress of the others, or +/-WIN once someone won.
+ *
+ * The distance to a target is the length of the shortest walk in the maze,
+ * bounded by SIZE plus the Manhattan distance: a target that cannot be
+ * reached counts like a long walk, and a target on the spare card counts
+ * MAX_DISTANCE.
+ *
+ * The turns of a MoveGenerator can be scored in a batch, without applying
+ * them: the distances are computed once per insertion and shared by every
+ * destination of the insertion.
+ */
+class Evaluator
+{
+
+public:
+
+    /**
+     * @brief Is the score of a won game.
+     */
+    static constexpr int WIN = 1 << 20;
+
+    /**
+     * @brief Is the distance of a target on the spare card, above any other
+     * distance.
+     */
+    static constexpr unsigned MAX_DISTANCE = 3 * model::Maze::SIZE;
+
+private:
+
+    /**
+     * @brief Are the weights of the features.
+     */
+    EvaluationWeights weights_;
+
+    int getProgress(const PlayerFeatures &features) const;
+
+    int combine(const PlayerFeatures *features, unsigned nbOfPlayers, unsigned player) const;
+
+public:
+
+    /**
+     * @brief Constructs this evaluator.
+     *
+     * @param weights are the weights of the features.
+     */
+    explicit Evaluator(const EvaluationWeights &weights = EvaluationWeights{})
+        : weights_{weights}
+    {}
+
+    /**
+     * @brief Gets the weights of the features.
+     *
+     * @return the weights of this evaluator.
+     */
+    const EvaluationWeights &getWeights() const { return weights_; }
+
+    /**
+     * @brief Gets the features of the given player.
+     *
+     * @param game is the game the player takes part in.
+     * @param player is the index of the player.
+     * @return the features of the player.
+     */
+    static PlayerFeatures getFeatures(const model::Game &game, unsigned player);
+
+    /**
+     * @brief Scores the given game for the given player.
+     *
+     * @param game is the game to score.
+     * @param player is the index of the player to score the game for.
+     * @return the score of the game.
+     */
+    int evaluate(const model::Game &game, unsigned player) const;
+
+    /**
+     * @brief Scores, for the given player, the game resulting from each turn
+     * of the given generator. The scores are the ones evaluate gives once the
+     * turns are applied.
+     *
+     * @param game is the game the turns are generated for.
+     * @param generator is the generator of the turns of the current player.
+     * @param player is the index of the player to score the games for.
+     * @param scores are filled with the scores, indexed like the moves of the
+     * generator.
+     */
+    void evaluate(const model::Game &game, const model::MoveGenerator &generator,
+                  unsigned player, std::vector<int> &scores) const;
+
+};
+
+}}
+
+#endif // EVALUATOR_H
@@ -0,0 +1,48 @@
+#include "GreedyPolicy.h"
+#include "MoveGenerator.h"
+
+#include <vector>
+
+using namespace labyrinth::model;
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Gets the weights scoring the progress of the current player alone.
+ */
+static EvaluationWeights getGreedyWeights()
+{
+    EvaluationWeights weights;
+    weights.opponents = 0;
+    return weights;
+}
+
+GreedyPolicy::GreedyPolicy(unsigned seed)
+    : engine_{seed},
+      evaluator_{getGreedyWeights()}
+{}
+
+Turn GreedyPolicy::chooseTurn(const Game &game)
+{
+    MoveGenerator generator{game};
+    const std::vector<MoveGenerator::Move> &moves = generator.getMoves();
+    std::vector<int> scores;
+    evaluator_.evaluate(game, generator, game.getCurrentPlayerIndex(), scores);
+    int best = 0;
+    unsigned ties = 0;
+    Turn chosen = moves.at(0).turn;
+    for (unsigned index = 0; index < moves.size(); ++index) {
+        if (ties == 0 || scores[index] > best) {
+            best = scores[index];
+            ties = 1;
+            chosen = moves[index].turn;
+        } else if (scores[index] == best) {
+            ++ties;
+            std::uniform_int_distribution<unsigned> distribution{0, ties - 1};
+            if (distribution(engine_) == 0) chosen = moves[index].turn;
+        }
+    }
+    return chosen;
+}
+
+}}
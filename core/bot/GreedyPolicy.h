@@ -0,0 +1,48 @@
+#ifndef GREEDYPOLICY_H
+#define GREEDYPOLICY_H
+
+#include <random>
+
+#include "Evaluator.h"
+#include "Policy.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Plays the turn ending the closest to the current target of the
+ * current player, walking through the maze. The target is his/ her current
+ * objective, or his/ her initial position once all the objectives are found.
+ * The turns are scored by an Evaluator ignoring the other players. Ties are
+ * broken at random.
+ */
+class GreedyPolicy : public Policy
+{
+
+    /**
+     * @brief Is the random engine used to break ties.
+     */
+    std::mt19937 engine_;
+
+    /**
+     * @brief Is the evaluator scoring the turns.
+     */
+    Evaluator evaluator_;
+
+public:
+
+    /**
+     * @brief Constructs this policy.
+     *
+     * @param seed is the seed of the random engine of this policy.
+     */
+    explicit GreedyPolicy(unsigned seed);
+
+    std::string getName() const override { return "greedy"; }
+
+    model::Turn chooseTurn(const model::Game &game) override;
+
+};
+
+}}
+
+#endif // GREEDYPOLICY_H
@@ -0,0 +1,258 @@
+#include "MctsPolicy.h"
+#include "GameState.h"
+#include "MoveGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+using namespace labyrinth::model;
+
+namespace labyrinth { namespace bot {
+
+constexpr std::uint32_t MctsPolicy::NO_NODE;
+
+/**
+ * @brief Is the greatest number of turns of a player: every insertion slot
+ * but the blocked one, in every rotation, to every cell.
+ */
+static constexpr std::size_t MAX_NB_OF_TURNS = (Maze::NB_OF_SLOTS - 1) * 4
+        * MazeBitboard::CELLS;
+
+static int getDistance(const MazePosition &lhs, const MazePosition &rhs)
+{
+    int rows = static_cast<int>(lhs.getRow()) - static_cast<int>(rhs.getRow());
+    int columns = static_cast<int>(lhs.getColumn()) - static_cast<int>(rhs.getColumn());
+    return std::abs(rows) + std::abs(columns);
+}
+
+/**
+ * @brief Gets the distance between the given position and the target of the
+ * given player, his/ her objective or his/ her initial position once all the
+ * objectives are found.
+ *
+ * @param maze is the maze the player is in.
+ * @param player is the player to move.
+ * @param position is the position to measure from.
+ * @return the distance to the target, twice the size of the maze if the
+ * objective is not in it.
+ */
+static int getDistanceToTarget(const Maze &maze, const Player &player,
+                               const MazePosition &position)
+{
+    if (player.hasFoundAllObjectives()) {
+        return getDistance(position, player.getInitialPosition());
+    } else if (maze.isInside(player.getObjective())) {
+        return getDistance(position, maze.getObjectPosition(player.getObjective()));
+    }
+    return 2 * static_cast<int>(Maze::SIZE);
+}
+
+/**
+ * @brief Gets the reachable position the closest to the target of the given
+ * player.
+ *
+ * @param maze is the maze the player is in.
+ * @param player is the player to move.
+ * @param reachable are the positions the player can reach, not empty.
+ * @param distance is set to the distance between the returned position and
+ * the target.
+ * @return the closest position, the first one in case of a tie.
+ */
+static MazePosition getClosestToTarget(const Maze &maze, const Player &player,
+                                       const CellSet &reachable, int &distance)
+{
+    MazePosition closest = *reachable.begin();
+    distance = std::numeric_limits<int>::max();
+    for (MazePosition position : reachable) {
+        int candidate = getDistanceToTarget(maze, player, position);
+        if (candidate < distance) {
+            distance = candidate;
+            closest = position;
+        }
+    }
+    return closest;
+}
+
+MctsPolicy::MctsPolicy(unsigned seed, const MctsOptions &options)
+    : options_(options),
+      engine_{seed},
+      nbOfPlayouts_{0}
+{
+    if (options_.maxNbOfPlayouts == 0 && options_.maxMilliseconds == 0) {
+        throw std::invalid_argument("A search needs a playout or a time limit.");
+    }
+    std::size_t capacity = options_.memoryBudget / sizeof(Node);
+    if (capacity < MAX_NB_OF_TURNS + 1) {
+        throw std::invalid_argument("The memory budget cannot hold the children"
+                                    " of the root.");
+    }
+    nodes_.reserve(capacity);
+}
+
+bool MctsPolicy::expand(std::uint32_t node, const Game &game)
+{
+    MoveGenerator generator{game};
+    const std::vector<MoveGenerator::Move> &moves = generator.getMoves();
+    if (moves.empty() || nodes_.capacity() - nodes_.size() < moves.size()) {
+        return false;
+    }
+    std::uint32_t firstChild = static_cast<std::uint32_t>(nodes_.size());
+    std::uint8_t player = static_cast<std::uint8_t>(game.getCurrentPlayerIndex());
+    const Player &current = game.getPlayer(player);
+    for (const MoveGenerator::Move &move : moves) {
+        const Maze &maze = generator.getShiftOf(move).maze;
+        float prior = 0.f;
+        if (!current.hasFoundAllObjectives() && maze.isInside(current.getObjective())
+                && maze.getObjectPosition(current.getObjective()) == move.turn.destination) {
+            prior = 1.f;
+        } else {
+            int distance = getDistanceToTarget(maze, current, move.turn.destination);
+            prior = 0.5f * (1.f - distance / (2.f * Maze::SIZE));
+        }
+        nodes_.push_back(Node{move.turn, node, NO_NODE, 0, player, 0, 0.f, prior});
+    }
+    std::shuffle(nodes_.begin() + firstChild, nodes_.end(), engine_);
+    nodes_[node].firstChild = firstChild;
+    nodes_[node].nbOfChildren = static_cast<std::uint16_t>(moves.size());
+    return true;
+}
+
+std::uint32_t MctsPolicy::select(std::uint32_t node) const
+{
+    const Node &parent = nodes_[node];
+    double logOfVisits = std::log(static_cast<double>(parent.nbOfVisits) + 1);
+    std::uint32_t selected = parent.firstChild;
+    double best = -1;
+    for (std::uint32_t child = parent.firstChild;
+         child < parent.firstChild + parent.nbOfChildren; ++child) {
+        const Node &candidate = nodes_[child];
+        double score = (candidate.reward + options_.priorWeight * candidate.prior)
+                / (candidate.nbOfVisits + options_.priorWeight)
+                + options_.exploration * std::sqrt(logOfVisits / (candidate.nbOfVisits + 1));
+        if (score > best) {
+            best = score;
+            selected = child;
+        }
+    }
+    return selected;
+}
+
+/**
+ * @brief Picks a random position among the given ones.
+ */
+static MazePosition pickRandomPosition(const CellSet &positions, std::mt19937 &engine)
+{
+    std::uniform_int_distribution<unsigned> distribution{0, positions.size() - 1};
+    unsigned index = distribution(engine);
+    for (MazePosition position : positions) {
+        if (index-- == 0) return position;
+    }
+    return *positions.begin();
+}
+
+TurnRecord MctsPolicy::playRandomTurn(Game &game)
+{
+    const auto &slots = Maze::getInsertionSlots();
+    std::uniform_int_distribution<std::size_t> slotDistribution{0, slots.size() - 1};
+    const Maze &maze = game.getMaze();
+    std::uniform_int_distribution<unsigned> rotationDistribution{
+        0, maze.getLastPushedOutMazeCard().getNbOfOrientations() - 1};
+    const Player &player = game.getPlayer(game.getCurrentPlayerIndex());
+    Turn turn;
+    int best = std::numeric_limits<int>::max();
+    for (unsigned sample = 0; sample < std::max(1u, options_.nbOfPlayoutShifts); ++sample) {
+        MazePosition candidate = slots[slotDistribution(engine_)];
+        while (!maze.isInserrable(candidate)) {
+            candidate = slots[slotDistribution(engine_)];
+        }
+        unsigned rotation = rotationDistribution(engine_);
+        Maze shifted = maze;
+        shifted.getLastPushedOutMazeCard().rotate(rotation);
+        shifted.insertLastPushedOutMazeCardAt(candidate);
+        MazePosition start = maze.getShiftedPosition(player.getPosition(), candidate);
+        CellSet reachable = shifted.reachableFrom(start);
+        int distance = 0;
+        MazePosition destination = options_.nbOfPlayoutShifts > 0
+                ? getClosestToTarget(shifted, player, reachable, distance)
+                : pickRandomPosition(reachable, engine_);
+        if (distance < best) {
+            best = distance;
+            turn = Turn{candidate, rotation, destination};
+        }
+    }
+    return game.applyTurn(turn);
+}
+
+void MctsPolicy::playout(Game &game, std::vector<TurnRecord> &records,
+                         std::vector<float> &rewards)
+{
+    for (unsigned turn = 0; turn < options_.maxPlayoutLength && !game.isOver(); ++turn) {
+        records.push_back(playRandomTurn(game));
+    }
+    if (game.isOver()) {
+        std::fill(rewards.begin(), rewards.end(), 0.f);
+        rewards.at(game.getWinner().getColor()) = 1.f;
+    } else {
+        std::fill(rewards.begin(), rewards.end(), 1.f / rewards.size());
+    }
+}
+
+Turn MctsPolicy::chooseTurn(const Game &game)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point deadline = Clock::now()
+            + std::chrono::milliseconds{options_.maxMilliseconds};
+    // The game restored from the state has no observer. Every playout applies
+    // its turns to it and undoes them, so the game is never copied again.
+    Game state{GameState{game}};
+    nodes_.clear();
+    nodes_.push_back(Node{Turn{}, NO_NODE, NO_NODE, 0, 0, 0, 0.f, 0.f});
+    if (!expand(0, state)) {
+        throw std::logic_error("The current player has no turn to play.");
+    }
+
+    std::vector<float> rewards(state.getNbOfPlayers());
+    std::vector<TurnRecord> records;
+    records.reserve(options_.maxPlayoutLength);
+    for (nbOfPlayouts_ = 0;
+         (options_.maxNbOfPlayouts == 0 || nbOfPlayouts_ < options_.maxNbOfPlayouts)
+         && (options_.maxMilliseconds == 0 || Clock::now() < deadline);
+         ++nbOfPlayouts_) {
+        std::uint32_t node = 0;
+        while (nodes_[node].nbOfChildren > 0) {
+            node = select(node);
+            records.push_back(state.applyTurn(nodes_[node].turn));
+        }
+        if (nodes_[node].nbOfVisits > 0 && !state.isOver() && expand(node, state)) {
+            node = select(node);
+            records.push_back(state.applyTurn(nodes_[node].turn));
+        }
+        playout(state, records, rewards);
+        for (; node != NO_NODE; node = nodes_[node].parent) {
+            ++nodes_[node].nbOfVisits;
+            nodes_[node].reward += rewards[nodes_[node].player];
+        }
+        for (; !records.empty(); records.pop_back()) {
+            state.undoTurn(records.back());
+        }
+    }
+
+    const Node &rootNode = nodes_[0];
+    const Node *chosen = &nodes_[rootNode.firstChild];
+    for (std::uint32_t child = rootNode.firstChild;
+         child < rootNode.firstChild + rootNode.nbOfChildren; ++child) {
+        const Node &candidate = nodes_[child];
+        if (candidate.nbOfVisits > chosen->nbOfVisits
+                || (candidate.nbOfVisits == chosen->nbOfVisits
+                    && candidate.prior > chosen->prior)) {
+            chosen = &candidate;
+        }
+    }
+    return chosen->turn;
+}
+
+}}
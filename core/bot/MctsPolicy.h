@@ -0,0 +1,231 @@
+#ifndef MCTSPOLICY_H
+#define MCTSPOLICY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Policy.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Are the settings of a Monte Carlo tree search.
+ */
+struct MctsOptions
+{
+
+    /**
+     * @brief Is the number of playouts of a search, 0 for no limit.
+     */
+    unsigned maxNbOfPlayouts = 1000;
+
+    /**
+     * @brief Is the duration of a search in milliseconds, 0 for no limit.
+     */
+    unsigned maxMilliseconds = 0;
+
+    /**
+     * @brief Is the memory of the tree in bytes. The nodes are allocated once,
+     * when the policy is constructed, and the tree stops growing when they
+     * are all used.
+     */
+    std::size_t memoryBudget = std::size_t{16} << 20;
+
+    /**
+     * @brief Is the weight of the exploration in the UCT formula.
+     */
+    double exploration = 0.4;
+
+    /**
+     * @brief Is the number of playouts the heuristic prior of a turn is worth.
+     * The prior is 1 for a turn collecting the objective of the player, and
+     * decreases with the distance to his/ her target otherwise.
+     */
+    double priorWeight = 10;
+
+    /**
+     * @brief Is the number of turns after which a playout is a draw.
+     */
+    unsigned maxPlayoutLength = 400;
+
+    /**
+     * @brief Is the number of random insertions tried at each turn of a
+     * playout. The one letting the player get the closest to his/ her target
+     * is played, then the player moves to the reachable position the closest
+     * to the target. With 0, the insertion and the move are random.
+     */
+    unsigned nbOfPlayoutShifts = 4;
+
+};
+
+/**
+ * @brief Plays the turn that is the most visited by a Monte Carlo tree search.
+ * The tree is explored with UCT over the complete turns, and each new node is
+ * scored by a playout to the end of the game.
+ *
+ * The search runs on a single copy of the game restored from its GameState,
+ * which has no observer. The turns of the tree and of the playouts are applied
+ * to it with Game::applyTurn and undone after each playout, so no game is
+ * copied during the search. The turns of a playout are chosen among a few
+ * random insertions (see MctsOptions::nbOfPlayoutShifts), which is much
+ * cheaper than generating every turn.
+ */
+class MctsPolicy : public Policy
+{
+
+    /**
+     * @brief Represents a node of the tree, i.e. the state after a turn.
+     */
+    struct Node
+    {
+
+        /**
+         * @brief Is the turn leading to this node.
+         */
+        model::Turn turn;
+
+        /**
+         * @brief Is the index of the parent node.
+         */
+        std::uint32_t parent;
+
+        /**
+         * @brief Is the index of the first child, the children being stored one
+         * after the other.
+         */
+        std::uint32_t firstChild;
+
+        /**
+         * @brief Is the number of children, 0 until this node is expanded.
+         */
+        std::uint16_t nbOfChildren;
+
+        /**
+         * @brief Is the index of the player who played the turn.
+         */
+        std::uint8_t player;
+
+        /**
+         * @brief Is the number of playouts through this node.
+         */
+        std::uint32_t nbOfVisits;
+
+        /**
+         * @brief Is the sum of the rewards of the player of the turn.
+         */
+        float reward;
+
+        /**
+         * @brief Is the heuristic value of the turn, between 0 and 1.
+         */
+        float prior;
+
+    };
+
+    /**
+     * @brief Is the index of no node.
+     */
+    static constexpr std::uint32_t NO_NODE = 0xFFFFFFFF;
+
+    /**
+     * @brief Are the settings of the search.
+     */
+    MctsOptions options_;
+
+    /**
+     * @brief Is the random engine of the playouts.
+     */
+    std::mt19937 engine_;
+
+    /**
+     * @brief Is the pool of the nodes, allocated once with the capacity given
+     * by the memory budget.
+     */
+    std::vector<Node> nodes_;
+
+    /**
+     * @brief Is the number of playouts of the last search.
+     */
+    unsigned nbOfPlayouts_;
+
+    /**
+     * @brief Allocates the children of the given node, one per legal turn.
+     *
+     * @param node is the index of the node to expand.
+     * @param game is the game in the state of the node.
+     * @return false if the pool is exhausted.
+     */
+    bool expand(std::uint32_t node, const model::Game &game);
+
+    /**
+     * @brief Selects the child of the given node with the best UCT score. The
+     * mean reward of a child starts from its prior.
+     *
+     * @param node is the index of an expanded node.
+     * @return the index of the selected child.
+     */
+    std::uint32_t select(std::uint32_t node) const;
+
+    /**
+     * @brief Applies one turn of a playout.
+     *
+     * @param game is the game to play.
+     * @return the record of the turn, to undo it.
+     */
+    model::TurnRecord playRandomTurn(model::Game &game);
+
+    /**
+     * @brief Applies random turns until the end of the game.
+     *
+     * @param game is the game to play.
+     * @param records are appended with the records of the turns.
+     * @param rewards is set to the reward of each player.
+     */
+    void playout(model::Game &game, std::vector<model::TurnRecord> &records,
+                 std::vector<float> &rewards);
+
+public:
+
+    /**
+     * @brief Constructs this policy.
+     *
+     * @param seed is the seed of the random engine of this policy.
+     * @param options are the settings of the search.
+     * @throws std::invalid_argument if the search has neither a playout nor
+     * a time limit, or if the memory budget cannot hold the root and its
+     * children.
+     */
+    explicit MctsPolicy(unsigned seed, const MctsOptions &options = MctsOptions{});
+
+    std::string getName() const override { return "mcts"; }
+
+    model::Turn chooseTurn(const model::Game &game) override;
+
+    /**
+     * @brief Gets the number of playouts of the last search.
+     *
+     * @return the number of playouts run by the last call to chooseTurn.
+     */
+    unsigned getNbOfPlayouts() const { return nbOfPlayouts_; }
+
+    /**
+     * @brief Gets the number of nodes of the tree of the last search.
+     *
+     * @return the number of nodes allocated by the last call to chooseTurn.
+     */
+    std::size_t getNbOfNodes() const { return nodes_.size(); }
+
+    /**
+     * @brief Gets the maximum number of nodes of a tree.
+     *
+     * @return the number of nodes the memory budget holds.
+     */
+    std::size_t getCapacity() const { return nodes_.capacity(); }
+
+};
+
+}}
+
+#endif // MCTSPOLICY_H
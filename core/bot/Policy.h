@@ -0,0 +1,45 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <string>
+
+#include "Game.h"
+#include "Turn.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Represents an automated player. A policy chooses the complete turn
+ * of the current player of a game.
+ *
+ * A policy may keep a state between two calls (a random engine for instance),
+ * so an instance should only be used by one thread at a time.
+ */
+class Policy
+{
+
+public:
+
+    /**
+     * @brief Gets the name of this policy.
+     *
+     * @return the name of this policy.
+     */
+    virtual std::string getName() const = 0;
+
+    /**
+     * @brief Chooses the turn of the current player of the given game. The
+     * current player should be waiting for his/ her turn.
+     *
+     * @param game is the game to play.
+     * @return a legal turn for the current player.
+     */
+    virtual model::Turn chooseTurn(const model::Game &game) = 0;
+
+    virtual ~Policy() = default;
+
+};
+
+}}
+
+#endif // POLICY_H
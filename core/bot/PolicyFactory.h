@@ -0,0 +1,50 @@
+#ifndef POLICYFACTORY_H
+#define POLICYFACTORY_H
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Policy.h"
+#include "RandomPolicy.h"
+#include "GreedyPolicy.h"
+#include "TurnSearcher.h"
+#include "MctsPolicy.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief This class is used to construct the policies by their name.
+ */
+class PolicyFactory {
+
+public:
+
+    /**
+     * @brief Constructs the policy of the given name.
+     *
+     * @param name is the name of the policy, "random", "greedy", "search" or
+     * "mcts".
+     * @param seed is the seed of the random engine of the policy.
+     * @return the policy of the given name.
+     * @throws std::invalid_argument if no policy has the given name.
+     */
+    static std::unique_ptr<Policy> getPolicy(const std::string &name, unsigned seed)
+    {
+        if (name == "random") {
+            return std::unique_ptr<Policy>{new RandomPolicy{seed}};
+        } else if (name == "greedy") {
+            return std::unique_ptr<Policy>{new GreedyPolicy{seed}};
+        } else if (name == "search") {
+            return std::unique_ptr<Policy>{new TurnSearcher{seed}};
+        } else if (name == "mcts") {
+            return std::unique_ptr<Policy>{new MctsPolicy{seed}};
+        }
+        throw std::invalid_argument(name + " is not a known policy.");
+    }
+
+};
+
+}}
+
+#endif // POLICYFACTORY_H
@@ -0,0 +1,14 @@
+#include "RandomPolicy.h"
+#include "MoveGenerator.h"
+
+namespace labyrinth { namespace bot {
+
+model::Turn RandomPolicy::chooseTurn(const model::Game &game)
+{
+    model::MoveGenerator generator{game};
+    const auto &moves = generator.getMoves();
+    std::uniform_int_distribution<std::size_t> distribution{0, moves.size() - 1};
+    return moves.at(distribution(engine_)).turn;
+}
+
+}}
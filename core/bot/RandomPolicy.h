@@ -0,0 +1,40 @@
+#ifndef RANDOMPOLICY_H
+#define RANDOMPOLICY_H
+
+#include <random>
+
+#include "Policy.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Plays one of the legal turns, chosen uniformly at random.
+ */
+class RandomPolicy : public Policy
+{
+
+    /**
+     * @brief Is the random engine used to choose the turns.
+     */
+    std::mt19937 engine_;
+
+public:
+
+    /**
+     * @brief Constructs this policy.
+     *
+     * @param seed is the seed of the random engine of this policy.
+     */
+    explicit RandomPolicy(unsigned seed)
+        : engine_{seed}
+    {}
+
+    std::string getName() const override { return "random"; }
+
+    model::Turn chooseTurn(const model::Game &game) override;
+
+};
+
+}}
+
+#endif // RANDOMPOLICY_H
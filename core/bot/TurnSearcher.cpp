@@ -0,0 +1,112 @@
+#include "TurnSearcher.h"
+#include "GameState.h"
+#include "MoveGenerator.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace labyrinth::model;
+
+namespace labyrinth { namespace bot {
+
+constexpr int TurnSearcher::WIN;
+
+/**
+ * @brief Is a score no game reaches.
+ */
+static constexpr int INFINITE = std::numeric_limits<int>::max();
+
+int TurnSearcher::evaluate(const Game &game, unsigned player)
+{
+    return Evaluator{}.evaluate(game, player);
+}
+
+int TurnSearcher::search(Game &game, unsigned depth, int alpha, int beta,
+                         unsigned player, const Evaluator &evaluator,
+                         const std::atomic<int> &best, unsigned long long &nbOfNodes)
+{
+    if (depth == 0 || game.isOver()) {
+        return evaluator.evaluate(game, player);
+    }
+    MoveGenerator generator{game};
+    const std::vector<MoveGenerator::Move> &moves = generator.getMoves();
+    if (moves.empty()) {
+        return evaluator.evaluate(game, player);
+    }
+    alpha = std::max(alpha, best.load(std::memory_order_relaxed) - 1);
+    bool isMaximizing = game.getCurrentPlayerIndex() == player;
+    std::vector<int> leaves;
+    if (depth == 1) {
+        evaluator.evaluate(game, generator, player, leaves);
+    }
+    for (unsigned index = 0; index < moves.size(); ++index) {
+        ++nbOfNodes;
+        int score;
+        if (depth == 1) {
+            score = leaves[index];
+        } else {
+            TurnRecord record = game.applyTurn(moves[index].turn);
+            score = search(game, depth - 1, alpha, beta, player, evaluator, best, nbOfNodes);
+            game.undoTurn(record);
+        }
+        if (isMaximizing) {
+            alpha = std::max(alpha, score);
+        } else {
+            beta = std::min(beta, score);
+        }
+        if (alpha >= beta) break;
+    }
+    return isMaximizing ? alpha : beta;
+}
+
+SearchResult TurnSearcher::search(const Game &game)
+{
+    // The copy drops the observers of the game, which must not be notified
+    // from the threads of the pool.
+    const Game root{GameState{game}};
+    const unsigned player = root.getCurrentPlayerIndex();
+    MoveGenerator generator{root};
+    const std::vector<MoveGenerator::Move> &moves = generator.getMoves();
+    if (moves.empty()) {
+        throw std::logic_error("The current player has no turn to play.");
+    }
+    std::vector<std::vector<unsigned>> movesOfShifts(generator.getShifts().size());
+    for (unsigned index = 0; index < moves.size(); ++index) {
+        movesOfShifts.at(moves[index].shift).push_back(index);
+    }
+
+    std::vector<int> scores(moves.size(), -INFINITE);
+    std::atomic<int> best{-INFINITE};
+    std::atomic<unsigned long long> nbOfNodes{0};
+    WorkStealingPool::TaskGroup group;
+    for (const std::vector<unsigned> &movesOfShift : movesOfShifts) {
+        pool_.submit(group, [&, movesOfShift] {
+            for (unsigned index : movesOfShift) {
+                pool_.submit(group, [&, index] {
+                    Game child{root};
+                    child.applyTurn(moves[index].turn);
+                    unsigned long long nodes = 1;
+                    int score = search(child, depth_ - 1, best.load() - 1, INFINITE,
+                                       player, evaluator_, best, nodes);
+                    scores[index] = score;
+                    int current = best.load();
+                    while (score > current && !best.compare_exchange_weak(current, score)) {}
+                    nbOfNodes += nodes;
+                });
+            }
+        });
+    }
+    pool_.wait(group);
+
+    int bestScore = *std::max_element(scores.begin(), scores.end());
+    std::vector<unsigned> bestMoves;
+    for (unsigned index = 0; index < moves.size(); ++index) {
+        if (scores[index] == bestScore) bestMoves.push_back(index);
+    }
+    std::uniform_int_distribution<std::size_t> distribution{0, bestMoves.size() - 1};
+    return SearchResult{moves[bestMoves[distribution(engine_)]].turn, bestScore,
+                        nbOfNodes.load()};
+}
+
+}}
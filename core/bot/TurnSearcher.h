@@ -0,0 +1,160 @@
+#ifndef TURNSEARCHER_H
+#define TURNSEARCHER_H
+
+#include <atomic>
+#include <random>
+
+#include "Evaluator.h"
+#include "Policy.h"
+#include "WorkStealingPool.h"
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Is the result of a search.
+ */
+struct SearchResult
+{
+
+    /**
+     * @brief Is the best turn found for the current player.
+     */
+    model::Turn turn;
+
+    /**
+     * @brief Is the score of the best turn, from the point of view of the
+     * current player.
+     */
+    int score;
+
+    /**
+     * @brief Is the number of turns explored. It depends on the scheduling of
+     * the threads.
+     */
+    unsigned long long nbOfNodes;
+
+};
+
+/**
+ * @brief Plays the turn with the best minimax score over a few turns. The
+ * other players are assumed to play against the current one, and the game is
+ * scored once the depth is reached (see Evaluator). The turns of the last
+ * searched player are scored in a batch, without being applied.
+ *
+ * The turns of the current player, and for each of them the answers of the
+ * next player, are searched in parallel on a work-stealing pool. The best
+ * score found so far is shared, so the other branches are cut as soon as they
+ * cannot beat it. Only branches scoring strictly less than the shared score
+ * are cut, so the exact scores of the best turns, and then the chosen turn,
+ * do not depend on the number of threads nor on their scheduling. Ties are
+ * broken at random.
+ */
+class TurnSearcher : public Policy
+{
+
+    /**
+     * @brief Is the random engine used to break ties.
+     */
+    std::mt19937 engine_;
+
+    /**
+     * @brief Is the number of turns searched, the one of the current player
+     * included.
+     */
+    unsigned depth_;
+
+    /**
+     * @brief Is the evaluator scoring the games once the depth is reached.
+     */
+    Evaluator evaluator_;
+
+    /**
+     * @brief Is the pool running the branches of the search.
+     */
+    WorkStealingPool pool_;
+
+    /**
+     * @brief Scores the given game with alpha-beta pruning.
+     *
+     * @param game is the game to score, restored before returning.
+     * @param depth is the number of turns left to search.
+     * @param alpha is the score the searching player is already sure of.
+     * @param beta is the score the other players are already sure of.
+     * @param player is the index of the searching player.
+     * @param evaluator scores the games once the depth is reached.
+     * @param best is the best score shared by the branches of the search.
+     * @param nbOfNodes counts the explored turns.
+     * @return the score of the game, exact if between alpha and beta.
+     */
+    static int search(model::Game &game, unsigned depth, int alpha, int beta,
+                      unsigned player, const Evaluator &evaluator,
+                      const std::atomic<int> &best,
+                      unsigned long long &nbOfNodes);
+
+public:
+
+    /**
+     * @brief Is the score of a won game.
+     */
+    static constexpr int WIN = Evaluator::WIN;
+
+    /**
+     * @brief Constructs this searcher.
+     *
+     * @param seed is the seed of the random engine of this searcher.
+     * @param depth is the number of turns to search, at least 1.
+     * @param nbOfThreads is the number of threads of the search.
+     * @param weights are the weights of the evaluation of the games.
+     */
+    explicit TurnSearcher(unsigned seed, unsigned depth = 2, unsigned nbOfThreads = 1,
+                          const EvaluationWeights &weights = EvaluationWeights{})
+        : engine_{seed},
+          depth_{depth > 0 ? depth : 1},
+          evaluator_{weights},
+          pool_{nbOfThreads}
+    {}
+
+    std::string getName() const override { return "search"; }
+
+    model::Turn chooseTurn(const model::Game &game) override {
+        return search(game).turn;
+    }
+
+    /**
+     * @brief Searches the best turn of the current player of the given game.
+     * The current player should be waiting for his/ her turn.
+     *
+     * @param game is the game to search.
+     * @return the best turn, its score and the number of explored turns.
+     */
+    SearchResult search(const model::Game &game);
+
+    /**
+     * @brief Gets the number of turns searched.
+     *
+     * @return the depth of the search.
+     */
+    unsigned getDepth() const { return depth_; }
+
+    /**
+     * @brief Gets the number of threads of the search.
+     *
+     * @return the number of threads of the pool of this searcher.
+     */
+    unsigned getNbOfThreads() const { return pool_.getNbOfThreads(); }
+
+    /**
+     * @brief Scores the given game for the given player with the default
+     * weights (see Evaluator).
+     *
+     * @param game is the game to score.
+     * @param player is the index of the player to score the game for.
+     * @return the score of the game.
+     */
+    static int evaluate(const model::Game &game, unsigned player);
+
+};
+
+}}
+
+#endif // TURNSEARCHER_H
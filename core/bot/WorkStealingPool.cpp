@@ -0,0 +1,137 @@
+#include "WorkStealingPool.h"
+
+#include <utility>
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Is the pool the calling thread works for, if any.
+ */
+static thread_local const WorkStealingPool *currentPool = nullptr;
+
+/**
+ * @brief Is the index of the queue of the calling thread in currentPool.
+ */
+static thread_local unsigned currentQueueIndex = 0;
+
+WorkStealingPool::WorkStealingPool(unsigned nbOfThreads)
+    : nbOfQueuedTasks_{0},
+      isStopping_{false}
+{
+    unsigned nbOfWorkers = nbOfThreads > 1 ? nbOfThreads - 1 : 0;
+    for (unsigned index = 0; index <= nbOfWorkers; ++index) {
+        queues_.emplace_back(new Queue);
+    }
+    for (unsigned index = 1; index <= nbOfWorkers; ++index) {
+        workers_.emplace_back(&WorkStealingPool::work, this, index);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{sleepMutex_};
+        isStopping_ = true;
+    }
+    wakeUp_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned WorkStealingPool::getQueueIndex() const
+{
+    return currentPool == this ? currentQueueIndex : 0;
+}
+
+bool WorkStealingPool::take(unsigned index, Task &task)
+{
+    {
+        Queue &own = *queues_[index];
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --nbOfQueuedTasks_;
+            return true;
+        }
+    }
+    for (unsigned offset = 1; offset < queues_.size(); ++offset) {
+        Queue &victim = *queues_[(index + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock{victim.mutex};
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --nbOfQueuedTasks_;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingPool::runOne(unsigned index)
+{
+    Task task;
+    if (!take(index, task)) {
+        return false;
+    }
+    try {
+        task.work();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock{task.group->errorMutex_};
+        if (!task.group->error_) {
+            task.group->error_ = std::current_exception();
+        }
+    }
+    --task.group->nbOfPendingTasks_;
+    return true;
+}
+
+void WorkStealingPool::work(unsigned index)
+{
+    currentPool = this;
+    currentQueueIndex = index;
+    for (;;) {
+        if (runOne(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{sleepMutex_};
+        wakeUp_.wait(lock, [this] { return isStopping_ || nbOfQueuedTasks_ > 0; });
+        if (isStopping_ && nbOfQueuedTasks_ == 0) {
+            return;
+        }
+    }
+}
+
+void WorkStealingPool::submit(TaskGroup &group, std::function<void()> work)
+{
+    ++group.nbOfPendingTasks_;
+    Queue &queue = *queues_[getQueueIndex()];
+    {
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.tasks.push_back(Task{std::move(work), &group});
+        ++nbOfQueuedTasks_;
+    }
+    {
+        std::lock_guard<std::mutex> lock{sleepMutex_};
+    }
+    wakeUp_.notify_one();
+}
+
+void WorkStealingPool::wait(TaskGroup &group)
+{
+    unsigned index = getQueueIndex();
+    while (group.nbOfPendingTasks_ > 0) {
+        if (!runOne(index)) {
+            std::this_thread::yield();
+        }
+    }
+    std::lock_guard<std::mutex> lock{group.errorMutex_};
+    if (group.error_) {
+        std::exception_ptr error = group.error_;
+        group.error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+}}
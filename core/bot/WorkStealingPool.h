@@ -0,0 +1,195 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace labyrinth { namespace bot {
+
+/**
+ * @brief Runs tasks on a fixed set of threads. Each thread owns a queue: it
+ * runs its own tasks last in, first out, and steals the oldest tasks of the
+ * other queues when its own one is empty. A task submitted from a task stays
+ * on the thread that submitted it, unless another thread runs out of work.
+ *
+ * The thread waiting for a group of tasks runs tasks too, so a pool of n
+ * threads only starts n - 1 workers.
+ */
+class WorkStealingPool
+{
+
+public:
+
+    /**
+     * @brief Represents a set of tasks that are waited for together.
+     */
+    class TaskGroup
+    {
+
+        friend class WorkStealingPool;
+
+        /**
+         * @brief Is the number of tasks of this group not yet done.
+         */
+        std::atomic<unsigned> nbOfPendingTasks_{0};
+
+        /**
+         * @brief Protects the error of this group.
+         */
+        std::mutex errorMutex_;
+
+        /**
+         * @brief Is the first exception thrown by a task of this group.
+         */
+        std::exception_ptr error_;
+
+    };
+
+private:
+
+    /**
+     * @brief Represents a submitted task.
+     */
+    struct Task
+    {
+
+        std::function<void()> work;
+
+        TaskGroup *group;
+
+    };
+
+    /**
+     * @brief Represents the queue of tasks of a thread.
+     */
+    struct Queue
+    {
+
+        std::mutex mutex;
+
+        std::deque<Task> tasks;
+
+    };
+
+    /**
+     * @brief Are the queues of the threads. The first one is shared by the
+     * threads that do not belong to this pool, the worker i owns the queue
+     * i + 1.
+     */
+    std::vector<std::unique_ptr<Queue>> queues_;
+
+    /**
+     * @brief Are the worker threads.
+     */
+    std::vector<std::thread> workers_;
+
+    /**
+     * @brief Is the number of tasks waiting in the queues.
+     */
+    std::atomic<unsigned> nbOfQueuedTasks_;
+
+    /**
+     * @brief Protects the sleep of the idle workers.
+     */
+    std::mutex sleepMutex_;
+
+    /**
+     * @brief Wakes the idle workers up when a task is submitted.
+     */
+    std::condition_variable wakeUp_;
+
+    /**
+     * @brief Tells if the workers should stop, guarded by sleepMutex_.
+     */
+    bool isStopping_;
+
+    /**
+     * @brief Gets the index of the queue of the calling thread.
+     *
+     * @return the index of the queue the calling thread owns, 0 if it does not
+     * belong to this pool.
+     */
+    unsigned getQueueIndex() const;
+
+    /**
+     * @brief Takes a task, from the given queue first, then from the others.
+     *
+     * @param index is the index of the queue of the calling thread.
+     * @param task is set to the taken task.
+     * @return true if a task was taken.
+     */
+    bool take(unsigned index, Task &task);
+
+    /**
+     * @brief Runs one task, if any is queued.
+     *
+     * @param index is the index of the queue of the calling thread.
+     * @return true if a task was run.
+     */
+    bool runOne(unsigned index);
+
+    /**
+     * @brief Runs the tasks of the worker owning the given queue until this
+     * pool is destroyed.
+     *
+     * @param index is the index of the queue of the worker.
+     */
+    void work(unsigned index);
+
+public:
+
+    /**
+     * @brief Constructs this pool and starts its workers.
+     *
+     * @param nbOfThreads is the number of threads running the tasks, the
+     * waiting thread included. 0 is understood as 1.
+     */
+    explicit WorkStealingPool(unsigned nbOfThreads);
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    /**
+     * @brief Stops the workers once every queued task is run.
+     */
+    ~WorkStealingPool();
+
+    /**
+     * @brief Gets the number of threads running the tasks of this pool.
+     *
+     * @return the number of workers plus the waiting thread.
+     */
+    unsigned getNbOfThreads() const {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    /**
+     * @brief Submits a task. The task may submit other tasks to the same
+     * group, which is then only done once they are done too.
+     *
+     * @param group is the group the task belongs to.
+     * @param work is the task to run.
+     */
+    void submit(TaskGroup &group, std::function<void()> work);
+
+    /**
+     * @brief Runs tasks until every task of the given group is done.
+     *
+     * @param group is the group to wait for.
+     * @throws the first exception thrown by a task of the group.
+     */
+    void wait(TaskGroup &group);
+
+};
+
+}}
+
+#endif // WORKSTEALINGPOOL_H
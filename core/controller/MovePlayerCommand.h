@@ -33,9 +33,7 @@ public:
         unsigned column = std::stoul(argv_[2]);
         game_->selectPlayerPosition(model::MazePosition{row, column});
         game_->moveCurrentPlayer();
-        if (game_->hasCurrentPlayerFoundObjective()) {
-            game_->getCurrentPlayer().turnCurrentObjectiveOver();
-            game_->getCurrentPlayer().nextObjective();
+        if (game_->collectObjective()) {
             view_.print("You have found an objective!\n");
         }
         game_->nextPlayer();
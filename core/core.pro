@@ -11,13 +11,29 @@ TARGET = labyrinth
 
 SOURCES += \
     Main.cpp \
+    model/DistanceField.cpp \
     model/Game.cpp \
+    model/GameRecord.cpp \
+    model/GameState.cpp \
     model/Maze.cpp \
+    model/MoveGenerator.cpp \
+    model/MazeBitboard.cpp \
+    model/MazeCell.cpp \
     model/MazeCard.cpp \
     model/MazeCardsBuilder.cpp \
     model/MazeCardShape.cpp \
     model/MazePosition.cpp \
     model/ObjectivesDeck.cpp \
+    model/Zobrist.cpp \
+    bot/RandomPolicy.cpp \
+    bot/GreedyPolicy.cpp \
+    bot/Evaluator.cpp \
+    bot/TurnSearcher.cpp \
+    bot/MctsPolicy.cpp \
+    bot/WorkStealingPool.cpp \
+    view/console/Frame.cpp \
+    server/Session.cpp \
+    server/GameServer.cpp \
     view/console/Output.cpp \
     view/console/View.cpp \
     view/gui/GameWindow.cpp \
@@ -26,17 +42,40 @@ SOURCES += \
     view/gui/PathwayWidget.cpp
 
 HEADERS += \
+    model/DistanceField.h \
     model/Game.h \
+    model/GameRecord.h \
+    model/GameState.h \
     model/Maze.h \
+    model/MoveGenerator.h \
+    model/Turn.h \
+    model/TurnRecord.h \
+    model/CellSet.h \
+    model/MazeBitboard.h \
+    model/MazeCell.h \
     model/MazeCard.h \
     model/MazeCardsBuilder.h \
     model/MazeCardShape.h \
     model/MazeDirection.h \
     model/MazePosition.h \
+    model/RandomEngine.h \
     model/Object.h \
     model/ObjectCard.h \
     model/ObjectivesDeck.h \
+    model/Occupancy.h \
     model/Player.h \
+    model/Zobrist.h \
+    bot/Policy.h \
+    bot/PolicyFactory.h \
+    bot/RandomPolicy.h \
+    bot/GreedyPolicy.h \
+    bot/Evaluator.h \
+    bot/TurnSearcher.h \
+    bot/MctsPolicy.h \
+    bot/WorkStealingPool.h \
+    view/console/Frame.h \
+    server/Session.h \
+    server/GameServer.h \
     view/console/Output.h \
     view/console/View.h \
     view/console/ToString.h \
@@ -64,7 +103,9 @@ DESTDIR = $$PWD/../build
 INCLUDEPATH += \
     $$PWD \
     model \
+    bot \
     controller \
+    server \
     view/gui \
     view/console \
     observer
@@ -0,0 +1,153 @@
+#ifndef CELLSET_H
+#define CELLSET_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "MazeBitboard.h"
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Represents a set of positions of the maze. The set is stored as a
+ * bitboard, so it is copied and queried without allocation.
+ */
+class CellSet
+{
+
+    /**
+     * @brief Are the cells of this set.
+     */
+    Bitboard cells_;
+
+public:
+
+    /**
+     * @brief Iterates over the positions of a set, by row then by column.
+     */
+    class const_iterator
+    {
+
+        Bitboard remaining_;
+
+    public:
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef MazePosition value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const MazePosition *pointer;
+        typedef MazePosition reference;
+
+        explicit const_iterator(Bitboard remaining)
+            : remaining_{remaining}
+        {}
+
+        MazePosition operator*() const {
+            return MazeBitboard::getPosition(getLowestCell(remaining_));
+        }
+
+        const_iterator &operator++() {
+            remaining_ &= remaining_ - 1;
+            return *this;
+        }
+
+        bool operator==(const const_iterator &other) const {
+            return remaining_ == other.remaining_;
+        }
+
+        bool operator!=(const const_iterator &other) const {
+            return remaining_ != other.remaining_;
+        }
+
+    };
+
+    /**
+     * @brief Constructs an empty set.
+     */
+    CellSet()
+        : cells_{0}
+    {}
+
+    /**
+     * @brief Constructs the set of the cells of the given bitboard.
+     *
+     * @param cells are the cells of this set.
+     */
+    explicit CellSet(Bitboard cells)
+        : cells_{cells & MazeBitboard::ALL}
+    {}
+
+    /**
+     * @brief Gets the cells of this set as a bitboard.
+     *
+     * @return the cells of this set.
+     */
+    Bitboard getCells() const { return cells_; }
+
+    /**
+     * @brief Tells if the given position is in this set.
+     *
+     * @param position is the position to look for.
+     * @return true if the position is in this set.
+     */
+    bool contains(const MazePosition &position) const {
+        return MazeBitboard::isInside(position)
+                && ((cells_ >> MazeBitboard::getCell(position)) & 1);
+    }
+
+    /**
+     * @brief Adds the given position to this set. The position should be inside
+     * the maze.
+     *
+     * @param position is the position to add.
+     */
+    void insert(const MazePosition &position) {
+        cells_ |= MazeBitboard::getBit(MazeBitboard::getCell(position));
+    }
+
+    /**
+     * @brief Gets the number of positions in this set.
+     *
+     * @return the number of positions in this set.
+     */
+    unsigned size() const { return countCells(cells_); }
+
+    /**
+     * @brief Tells if this set is empty.
+     *
+     * @return true if this set contains no position.
+     */
+    bool empty() const { return cells_ == 0; }
+
+    /**
+     * @brief Gets the positions of this set, by row then by column.
+     *
+     * @return the positions of this set.
+     */
+    std::vector<MazePosition> getPositions() const {
+        return std::vector<MazePosition>(begin(), end());
+    }
+
+    const_iterator begin() const { return const_iterator{cells_}; }
+
+    const_iterator end() const { return const_iterator{0}; }
+
+    CellSet operator|(const CellSet &other) const {
+        return CellSet{cells_ | other.cells_};
+    }
+
+    CellSet operator&(const CellSet &other) const {
+        return CellSet{cells_ & other.cells_};
+    }
+
+    bool operator==(const CellSet &other) const { return cells_ == other.cells_; }
+
+    bool operator!=(const CellSet &other) const { return cells_ != other.cells_; }
+
+};
+
+}}
+
+#endif // CELLSET_H
@@ -0,0 +1,58 @@
+#include "DistanceField.h"
+
+#include <cstring>
+
+namespace labyrinth { namespace model {
+
+constexpr unsigned DistanceField::UNREACHABLE;
+
+DistanceField::DistanceField()
+    : reachable_{0}
+{
+    std::memset(distances_, UNREACHABLE, sizeof(distances_));
+}
+
+void DistanceField::fill(Bitboard right, Bitboard down, Bitboard sources)
+{
+    std::memset(distances_, UNREACHABLE, sizeof(distances_));
+    Bitboard reached = sources & MazeBitboard::ALL;
+    Bitboard frontier = reached;
+    for (std::uint8_t distance = 0; frontier; ++distance) {
+        for (Bitboard cells = frontier; cells; cells &= cells - 1) {
+            distances_[getLowestCell(cells)] = distance;
+        }
+        Bitboard next = ((frontier & right) << 1) | ((frontier >> 1) & right)
+                | ((frontier & down) << MazeBitboard::SIZE)
+                | ((frontier >> MazeBitboard::SIZE) & down);
+        frontier = next & ~reached;
+        reached |= frontier;
+    }
+    reachable_ = reached;
+}
+
+void DistanceField::compute(const MazeBitboard &pathways, Bitboard sources)
+{
+    fill(pathways.getLinks(RIGHT), pathways.getLinks(DOWN), sources);
+}
+
+void DistanceField::compute(const MazeBitboard &pathways, const Bitboard *sources,
+                            DistanceField *fields, unsigned count)
+{
+    Bitboard right = pathways.getLinks(RIGHT);
+    Bitboard down = pathways.getLinks(DOWN);
+    for (unsigned index = 0; index < count; ++index) {
+        fields[index].fill(right, down, sources[index]);
+    }
+}
+
+unsigned DistanceField::getMinDistance(Bitboard cells) const
+{
+    unsigned distance = UNREACHABLE;
+    for (cells &= reachable_; cells; cells &= cells - 1) {
+        unsigned candidate = distances_[getLowestCell(cells)];
+        if (candidate < distance) distance = candidate;
+    }
+    return distance;
+}
+
+}}
@@ -0,0 +1,127 @@
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include <cstdint>
+
+#include "MazeBitboard.h"
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Tells the length of the shortest walk from some source cells to
+ * every cell of the maze. The distances are kept in a fixed array, so a field
+ * is filled and copied without allocation.
+ *
+ * A field is filled by a breadth first search over the bitboards of the
+ * pathways: every step of the search reaches the whole next ring of cells
+ * with a few shifts and masks.
+ */
+class DistanceField
+{
+
+public:
+
+    /**
+     * @brief Is the distance of the cells that cannot be reached.
+     */
+    static constexpr unsigned UNREACHABLE = 0xFF;
+
+private:
+
+    /**
+     * @brief Are the distances of the cells, UNREACHABLE if no walk leads to
+     * them.
+     */
+    std::uint8_t distances_[MazeBitboard::CELLS];
+
+    /**
+     * @brief Are the cells that can be reached.
+     */
+    Bitboard reachable_;
+
+    void fill(Bitboard right, Bitboard down, Bitboard sources);
+
+public:
+
+    /**
+     * @brief Constructs a field in which no cell can be reached.
+     */
+    DistanceField();
+
+    /**
+     * @brief Fills this field with the distances from the nearest of the given
+     * cells.
+     *
+     * @param pathways are the pathways of the maze to walk in.
+     * @param sources are the cells to start from, at a distance of 0.
+     */
+    void compute(const MazeBitboard &pathways, Bitboard sources);
+
+    /**
+     * @brief Fills many fields, each from its own cells. The links of the
+     * pathways are computed once for all the fields.
+     *
+     * @param pathways are the pathways of the maze to walk in.
+     * @param sources are the cells to start from, one bitboard per field.
+     * @param fields are the fields to fill.
+     * @param count is the number of fields.
+     */
+    static void compute(const MazeBitboard &pathways, const Bitboard *sources,
+                        DistanceField *fields, unsigned count);
+
+    /**
+     * @brief Gets the distance of the given cell.
+     *
+     * @param cell is the index of the cell.
+     * @return the length of the shortest walk to the cell, UNREACHABLE if
+     * there is none.
+     */
+    unsigned getDistance(unsigned cell) const { return distances_[cell]; }
+
+    /**
+     * @brief Gets the distance of the given position. The position should be
+     * inside the maze.
+     *
+     * @param position is the position to get the distance of.
+     * @return the length of the shortest walk to the position, UNREACHABLE if
+     * there is none.
+     */
+    unsigned getDistance(const MazePosition &position) const {
+        return distances_[MazeBitboard::getCell(position)];
+    }
+
+    /**
+     * @brief Gets the cells that can be reached.
+     *
+     * @return the cells whose distance is not UNREACHABLE.
+     */
+    Bitboard getReachable() const { return reachable_; }
+
+    /**
+     * @brief Tells if the given position can be reached.
+     *
+     * @param position is the position to check.
+     * @return true if a walk leads to the position.
+     */
+    bool isReachable(const MazePosition &position) const {
+        return MazeBitboard::isInside(position)
+                && ((reachable_ >> MazeBitboard::getCell(position)) & 1);
+    }
+
+    /**
+     * @brief Gets the smallest distance of the given cells, for instance how
+     * close to an objective a player can walk when the field is filled from
+     * the objective and the cells are the ones the player can reach.
+     *
+     * @param cells are the cells to look at.
+     * @return the smallest distance of the cells, UNREACHABLE if none of them
+     * can be reached.
+     */
+    unsigned getMinDistance(Bitboard cells) const;
+
+};
+
+}}
+
+#endif // DISTANCEFIELD_H
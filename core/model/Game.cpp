@@ -1,4 +1,5 @@
 #include "Game.h"
+#include "Zobrist.h"
 #include <stdexcept>
 #include <vector>
 #include <algorithm>
@@ -12,23 +13,100 @@ unsigned Game::TOTAL_NB_OF_OBJECTIVES = 24;
 unsigned Game::MIN_NB_OF_PLAYERS = 2;
 unsigned Game::MAX_NB_OF_PLAYERS = 4;
 
-Game::Game(unsigned nbPlayers, bool isSimplified)
-    : currentMazeCard_{nullptr},
+Game::Game(unsigned nbPlayers, bool isSimplified, RandomEngine &engine)
+    : maze_{engine},
+      currentMazeCard_{nullptr},
       currentPlayerIndex_{0},
     isSimplified_{isSimplified}
 {
     if (nbPlayers < MIN_NB_OF_PLAYERS || MAX_NB_OF_PLAYERS < nbPlayers)
         throw logic_error(to_string(nbPlayers) + " is not a valid number of player!");
-    start(nbPlayers);
+    start(nbPlayers, engine);
 }
 
-static vector<ObjectCard> constructObjectives()
+/**
+ * @brief Checks the given state before a game is restored from it.
+ */
+static const GameState &requireValid(const GameState &state)
+{
+    state.requireValid();
+    return state;
+}
+
+Game::Game(const GameState &state)
+    : maze_{requireValid(state)},
+      currentMazeCard_{&maze_.getLastPushedOutMazeCard()},
+      selectedPlayerPosition_{MazeBitboard::getPosition(state.selectedPlayerCell)},
+      selectedInsertionPosition_{MazeBitboard::getPosition(state.selectedInsertionCell)},
+      currentPlayerIndex_{state.currentPlayer},
+      isSimplified_{state.isSimplified != 0}
+{
+    unsigned nbPlayers = state.nbOfPlayers;
+    unsigned nbObjectives = TOTAL_NB_OF_OBJECTIVES / nbPlayers;
+    Player::Color currentColor{Player::Color::RED};
+    for (unsigned i = 0; i < nbPlayers; ++i) {
+        Player player{currentColor, MazeBitboard::getPosition(state.playerCells[i])};
+        vector<ObjectCard> deck;
+        for (unsigned j = 0; j < nbObjectives; ++j) {
+            deck.push_back(static_cast<Object>(state.objectives[i * nbObjectives + j]));
+        }
+        player.setObjectives(ObjectivesDeck{deck});
+        for (unsigned j = 0; j < state.nbOfFoundObjectives[i]; ++j) {
+            player.turnCurrentObjectiveOver();
+            if (!player.hasFoundAllObjectives()) {
+                player.nextObjective();
+            }
+        }
+        player.setState(static_cast<Player::State>(state.playerStates[i]));
+        players_.push_back(player);
+        ++currentColor;
+    }
+    for (auto &player : players_) {
+        player.setOccupancy(&occupancy_);
+    }
+}
+
+Game::Game(const Game &that)
+    : nvs::Subject{},
+      maze_{that.maze_},
+      currentMazeCard_{&maze_.getLastPushedOutMazeCard()},
+      selectedPlayerPosition_{that.selectedPlayerPosition_},
+      selectedInsertionPosition_{that.selectedInsertionPosition_},
+      currentPlayerIndex_{that.currentPlayerIndex_},
+      players_{that.players_},
+      occupancy_{},
+      isSimplified_{that.isSimplified_}
+{
+    for (auto &player : players_) {
+        player.setOccupancy(&occupancy_);
+    }
+}
+
+Game &Game::operator=(const Game &that)
+{
+    if (this != &that) {
+        maze_ = that.maze_;
+        currentMazeCard_ = &maze_.getLastPushedOutMazeCard();
+        selectedPlayerPosition_ = that.selectedPlayerPosition_;
+        selectedInsertionPosition_ = that.selectedInsertionPosition_;
+        currentPlayerIndex_ = that.currentPlayerIndex_;
+        players_ = that.players_;
+        occupancy_ = Occupancy{};
+        for (auto &player : players_) {
+            player.setOccupancy(&occupancy_);
+        }
+        isSimplified_ = that.isSimplified_;
+    }
+    return *this;
+}
+
+static vector<ObjectCard> constructObjectives(RandomEngine &engine)
 {
     vector<ObjectCard> objectives;
     for(Object object{Object::GHOST}; object <= Object::HELMET; ++object){
         objectives.push_back(object);
     }
-    random_shuffle(objectives.begin(), objectives.end());
+    shuffle(objectives.begin(), objectives.end(), engine);
     return objectives;
 }
 
@@ -48,37 +126,20 @@ static ObjectivesDeck constructObjectivesDeck(vector<ObjectCard> &objectives,
     return ObjectivesDeck{deck};
 }
 
-static void dealObjectives(std::vector<Player> &players) {
-    vector<ObjectCard> objectives = constructObjectives();
+static void dealObjectives(std::vector<Player> &players, RandomEngine &engine) {
+    vector<ObjectCard> objectives = constructObjectives(engine);
     for(auto &player : players) {
         player.setObjectives(constructObjectivesDeck(objectives, players.size()));
     }
 }
 
-static MazePosition getStartPosition(unsigned player) {
-    switch (player)
-    {
-    case 0:
-        return MazePosition(0, 0);
-    case 1:
-        return MazePosition(0, 6);
-    case 2:
-        return MazePosition(6, 0);
-    case 3:
-        return MazePosition(6, 6);
-    default:
-        throw std::logic_error(to_string(player) + " is not a valid player id.");
-    }
-}
-
 static void setPlayersStartPosition(std::vector<Player> &players) {
-    for (unsigned player = 0; player < players.size(); ++player) {
-        MazePosition pos = getStartPosition(player);
-        players.at(player).setPosition(pos);
+    for (auto &player : players) {
+        player.setPosition(player.getInitialPosition());
     }
 }
 
-void Game::start(unsigned nbOfPlayers)
+void Game::start(unsigned nbOfPlayers, RandomEngine &engine)
 {
     Player::Color currentColor{Player::Color::RED};
     for (unsigned i = 0; i < nbOfPlayers; ++i) {
@@ -86,7 +147,10 @@ void Game::start(unsigned nbOfPlayers)
         ++currentColor;
     }
     setPlayersStartPosition(players_);
-    dealObjectives(players_);
+    for (auto &player : players_) {
+        player.setOccupancy(&occupancy_);
+    }
+    dealObjectives(players_, engine);
     currentMazeCard_ = &maze_.getLastPushedOutMazeCard();
     notifyObservers();
 }
@@ -106,44 +170,55 @@ Player Game::getWinner() const {
     return winner;
 }
 
+std::uint64_t Game::getKey() const {
+    std::uint64_t key = maze_.getKey();
+    for (unsigned index = 0; index < players_.size(); ++index) {
+        const Player &player = players_[index];
+        key ^= Zobrist::getPlayerKey(index, player.getCell().getIndex());
+        key ^= Zobrist::getProgressKey(index, player.getNbOfFoundObjectives());
+    }
+    const Player &current = players_.at(currentPlayerIndex_);
+    return key ^ Zobrist::getTurnKey(currentPlayerIndex_,
+                                     static_cast<unsigned>(current.getState()));
+}
+
 bool Game::hasCurrentPlayerFoundObjective() const {
-    Object currentObject = getCurrentPlayer().getObjective();
-    MazePosition objectivePosition = getObjectivePosition(currentObject);
-    return getCurrentPlayer().getPosition() == objectivePosition;
+    const Player &player = players_.at(currentPlayerIndex_);
+    Object currentObject = player.getObjective();
+    return maze_.isInside(currentObject)
+            && player.getCell().getIndex() == maze_.getObjectCell(currentObject);
 }
 
 bool Game::isAPlayerAt(const MazePosition &position) const {
-    for (auto const &player : players_) {
-        if (player.isAt(position)) return true;
-    }
-    return false;
+    return occupancy_.isOccupied(position);
 }
 
 MazePosition Game::getObjectivePosition(const Object &o) const {
-    MazePosition position;
-    for (unsigned row = 0; row < Maze::SIZE; row++) {
-        for (unsigned column = 0; column < Maze::SIZE; ++column) {
-            MazePosition current{row, column};
-            if (maze_.getCardAt(current).getObject() == o) {
-                position = current;
-            }
-        }
-    }
-    return position;
+    return maze_.isInside(o) ? maze_.getObjectPosition(o) : MazePosition{};
 }
 
 std::vector<Player> Game::getPlayersAt(const MazePosition &position) const {
     std::vector<Player> players;
+    std::uint8_t mask = occupancy_.getPlayersAt(position);
     for (auto const &player : players_) {
-        if (player.isAt(position)) players.push_back(player);
+        if ((mask >> player.getColor()) & 1) players.push_back(player);
     }
     return players;
 }
 
+void Game::computePlayerDistances(DistanceField *fields) const
+{
+    Bitboard sources[4];
+    unsigned nbOfPlayers = static_cast<unsigned>(players_.size());
+    for (unsigned index = 0; index < nbOfPlayers; ++index) {
+        sources[index] = players_[index].getCell().getBit();
+    }
+    DistanceField::compute(maze_.getPathways(), sources, fields, nbOfPlayers);
+}
+
 void Game::selectPlayerPosition(const MazePosition &position)
 {
-    MazePosition playerPosition = getCurrentPlayer().getPosition();
-    if (!maze_.existPathBetween(playerPosition, position)) {
+    if (!getReachablePositions().contains(position)) {
         throw std::logic_error("There is no way leading to this position");
     }
     selectedPlayerPosition_ = position;
@@ -158,56 +233,33 @@ void Game::movePathWays() {
     if(!getCurrentPlayer().isWaiting() || getCurrentPlayer().isReadyToMove()){
         throw std::logic_error("You already inserted a card!");
     }
+    Batch batch{*this};
     maze_.insertLastPushedOutMazeCardAt(selectedInsertionPosition_);
     currentMazeCard_ = &maze_.getLastPushedOutMazeCard();
     getCurrentPlayer().setReadyToMove();
     shiftPlayer();
-    notifyObservers();
+    notifyObservers(MAZE_CHANGED | TURN_CHANGED);
+    batch.commit();
 }
 
 void Game::shiftPlayer(){
+    shiftPlayersOfLastInsertion();
+    notifyObservers(PLAYERS_MOVED);
+}
 
+void Game::shiftPlayersOfLastInsertion(){
+    Bitboard shifted = maze_.getLastShiftedCells().getCells();
+    MazeCell insertion = MazeCell::of(selectedInsertionPosition_);
+    MazeCell opposite = MazeCell::of(maze_.getOpposite(selectedInsertionPosition_));
+    MazeDirection push = maze_.isOnSide(selectedInsertionPosition_, UP) ? DOWN
+            : maze_.isOnSide(selectedInsertionPosition_, DOWN) ? UP
+            : maze_.isOnSide(selectedInsertionPosition_, LEFT) ? RIGHT : LEFT;
     for(auto &player : players_){
-        if(player.getPosition() == maze_.getOpposite(selectedInsertionPosition_)){
-            player.setPosition(selectedInsertionPosition_);
-        }else{
-            if(player.getPosition().getRow() == selectedInsertionPosition_.getRow()){
-                shiftPlayerRow(player);
-            }
-            if(player.getPosition().getColumn() == selectedInsertionPosition_.getColumn()){
-                shiftPlayerColumn(player);
-            }
+        MazeCell cell = player.getCell();
+        if(!(shifted & cell.getBit())){
+            continue;
         }
-    }
-    notifyObservers();
-}
-void Game::shiftPlayerRow(Player &player){
-    unsigned row;
-    unsigned column;
-
-    if(maze_.isOnSide(selectedInsertionPosition_,RIGHT)){
-        row = player.getPosition().getRow();
-        column = player.getPosition().getColumn()- 1;
-        player.setPosition(MazePosition{row,column});
-    }else if(maze_.isOnSide(selectedInsertionPosition_,LEFT)){
-        row = player.getPosition().getRow();
-        column = player.getPosition().getColumn()+ 1;
-        player.setPosition(MazePosition{row,column});
-    }
-}
-
-void Game::shiftPlayerColumn(Player &player){
-    unsigned row;
-    unsigned column;
-
-    if(maze_.isOnSide(selectedInsertionPosition_,UP)){
-        row = player.getPosition().getRow() + 1;
-        column = player.getPosition().getColumn();
-        player.setPosition(MazePosition{row,column});
-    }else if(maze_.isOnSide(selectedInsertionPosition_,DOWN)){
-        row = player.getPosition().getRow() - 1;
-        column = player.getPosition().getColumn();
-        player.setPosition(MazePosition{row,column});
+        player.setCell(cell == opposite ? insertion : cell.getNeighbor(push));
     }
 }
 
@@ -221,7 +273,98 @@ void Game::moveCurrentPlayer() {
     }
     getCurrentPlayer().setPosition(selectedPlayerPosition_);
     getCurrentPlayer().setDone();
-    notifyObservers();
+    notifyObservers(PLAYERS_MOVED | TURN_CHANGED);
+}
+
+bool Game::turnFoundObjectiveOver()
+{
+    Player &player = getCurrentPlayer();
+    if (player.hasFoundAllObjectives() || !hasCurrentPlayerFoundObjective()) {
+        return false;
+    }
+    player.turnCurrentObjectiveOver();
+    if (!player.hasFoundAllObjectives()) {
+        player.nextObjective();
+    }
+    return true;
+}
+
+bool Game::collectObjective()
+{
+    if (!turnFoundObjectiveOver()) {
+        return false;
+    }
+    notifyObservers(OBJECTIVES_CHANGED);
+    return true;
+}
+
+bool Game::playTurn(const Turn &turn)
+{
+    // Applying and undoing the turn checks all of it without notifying, so an
+    // illegal turn leaves this game as it was.
+    undoTurn(applyTurn(turn));
+    Batch batch{*this};
+    getCurrentMazeCard().rotate(turn.rotation);
+    selectInsertionPosition(turn.insertion);
+    movePathWays();
+    selectPlayerPosition(turn.destination);
+    moveCurrentPlayer();
+    bool hasFoundObjective = collectObjective();
+    nextPlayer();
+    batch.commit();
+    return hasFoundObjective;
+}
+
+TurnRecord Game::applyTurn(const Turn &turn)
+{
+    Player &player = getCurrentPlayer();
+    if (!player.isWaiting()) {
+        throw std::logic_error("The player already started his/ her turn!");
+    }
+    maze_.requireInserrable(turn.insertion);
+    TurnRecord record;
+    record.turn = turn;
+    record.player = static_cast<std::uint8_t>(currentPlayerIndex_);
+    record.hasFoundObjective = false;
+    for (unsigned index = 0; index < players_.size(); ++index) {
+        record.playerCells[index] = static_cast<std::uint8_t>(
+                    players_[index].getCell().getIndex());
+    }
+    record.blockedPosition = maze_.getLastPushedOutMazePosition();
+    record.shiftedCells = maze_.getLastShiftedCells();
+    record.changedCells = maze_.getLastChangedCells();
+    record.selectedInsertionPosition = selectedInsertionPosition_;
+    record.selectedPlayerPosition = selectedPlayerPosition_;
+
+    getCurrentMazeCard().rotate(turn.rotation);
+    selectedInsertionPosition_ = turn.insertion;
+    maze_.insertLastPushedOutMazeCardAt(turn.insertion);
+    shiftPlayersOfLastInsertion();
+    if (!getReachablePositions().contains(turn.destination)) {
+        undoTurn(record);
+        throw std::logic_error("There is no way leading to this position");
+    }
+    selectedPlayerPosition_ = turn.destination;
+    player.setPosition(turn.destination);
+    record.hasFoundObjective = turnFoundObjectiveOver();
+    currentPlayerIndex_ = (currentPlayerIndex_ + 1) % players_.size();
+    return record;
+}
+
+void Game::undoTurn(const TurnRecord &record)
+{
+    currentPlayerIndex_ = record.player;
+    if (record.hasFoundObjective) {
+        getCurrentPlayer().restoreLastObjective();
+    }
+    maze_.undoInsertionAt(record.turn.insertion, record.blockedPosition,
+                          record.shiftedCells, record.changedCells);
+    getCurrentMazeCard().rotate(4 - record.turn.rotation % 4);
+    for (unsigned index = 0; index < players_.size(); ++index) {
+        players_[index].setCell(MazeCell{record.playerCells[index]});
+    }
+    selectedInsertionPosition_ = record.selectedInsertionPosition;
+    selectedPlayerPosition_ = record.selectedPlayerPosition;
 }
 
 void Game::nextPlayer()
@@ -235,7 +378,7 @@ void Game::nextPlayer()
     } else {
         currentPlayerIndex_++;
     }
-    notifyObservers();
+    notifyObservers(TURN_CHANGED);
 }
 
 bool Game::isOver() const
@@ -251,7 +394,6 @@ bool Game::isOver() const
                 return true;
         }
     }
-    notifyObservers();
     return false;
 }
 
@@ -1,11 +1,17 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <cstdint>
 #include <vector>
 #include "MazeCard.h"
 #include "Player.h"
 #include "Maze.h"
 #include "MazePosition.h"
+#include "Occupancy.h"
+#include "GameState.h"
+#include "RandomEngine.h"
+#include "Turn.h"
+#include "TurnRecord.h"
 #include "observer/Subject.h"
 
 namespace labyrinth { namespace model {
@@ -47,6 +53,12 @@ class Game : public nvs::Subject
      */
     std::vector<Player> players_;
 
+    /**
+     * @brief Tells which players stand on each cell. It is updated by the
+     * players of this game each time they move.
+     */
+    Occupancy occupancy_;
+
     /**
      * @brief Tells if this game is simplified. At the end of a simplified game
      * the winner is the player that has found all of his objectives.
@@ -55,6 +67,35 @@ class Game : public nvs::Subject
 
 public:
 
+    /**
+     * @brief Are the flags telling the observers what changed since their last
+     * update.
+     */
+    enum Change : nvs::Changes
+    {
+
+        /**
+         * @brief The cards of the maze or the current maze card changed.
+         */
+        MAZE_CHANGED = 1 << 0,
+
+        /**
+         * @brief At least one player changed position.
+         */
+        PLAYERS_MOVED = 1 << 1,
+
+        /**
+         * @brief The current player or the phase of his/ her turn changed.
+         */
+        TURN_CHANGED = 1 << 2,
+
+        /**
+         * @brief The current player found an objective.
+         */
+        OBJECTIVES_CHANGED = 1 << 3
+
+    };
+
     static unsigned TOTAL_NB_OF_OBJECTIVES;
 
     /**
@@ -77,7 +118,60 @@ public:
      * number of players is set to 4 (maximal capacity);
      * @param isSimplified tell if this game is simplified or not.
      */
-    Game(unsigned nbOfPlayers=MAX_NB_OF_PLAYERS, bool isSimplified = false);
+    Game(unsigned nbOfPlayers=MAX_NB_OF_PLAYERS, bool isSimplified = false)
+        : Game{nbOfPlayers, isSimplified, getRandomSeed()}
+    {}
+
+    /**
+     * @brief Constructs this game from the given seed. Two games constructed
+     * from the same seed have the same maze and deal the same objectives.
+     *
+     * @param nbOfPlayers is the number of player of this game.
+     * @param isSimplified tell if this game is simplified or not.
+     * @param seed is the seed of the random engine setting this game up.
+     */
+    Game(unsigned nbOfPlayers, bool isSimplified, unsigned seed)
+        : Game{nbOfPlayers, isSimplified, RandomEngine{seed}}
+    {}
+
+    /**
+     * @brief Constructs this game with the given random engine, which shuffles
+     * the maze cards and the objectives.
+     *
+     * @param nbOfPlayers is the number of player of this game.
+     * @param isSimplified tell if this game is simplified or not.
+     * @param engine is the random engine setting this game up.
+     */
+    Game(unsigned nbOfPlayers, bool isSimplified, RandomEngine &engine);
+
+    /**
+     * @brief Constructs the game of the given state. The observers are not
+     * notified.
+     *
+     * @param state is the state to restore.
+     * @throws std::invalid_argument if a field of the state is out of its
+     * range (see GameState::requireValid).
+     */
+    explicit Game(const GameState &state);
+
+    /**
+     * @brief Constructs a copy of the given game. The players and the current
+     * maze card of the copy belong to the copy. The copy starts with no
+     * observers: the observers of the given game are not notified of the
+     * changes of the copy.
+     *
+     * @param that is the game to copy.
+     */
+    Game(const Game &that);
+
+    /**
+     * @brief Assigns the given game to this one. This game keeps its own
+     * observers, the ones of the given game are not copied.
+     *
+     * @param that is the game to assign.
+     * @return this game.
+     */
+    Game &operator=(const Game &that);
 
     /**
      * @brief Tells if this game is simplified.
@@ -107,6 +201,31 @@ public:
      */
     std::vector<Player> getPlayers() const {return players_;}
 
+    /**
+     * @brief Gets the number of players taking part to this game.
+     *
+     * @return the number of players of this game.
+     */
+    unsigned getNbOfPlayers() const {
+        return static_cast<unsigned>(players_.size());
+    }
+
+    /**
+     * @brief Gets the player at the given index. Players are indexed in their
+     * playing order.
+     *
+     * @param index is the index of the player.
+     * @return the player at the given index.
+     */
+    const Player &getPlayer(unsigned index) const { return players_.at(index); }
+
+    /**
+     * @brief Gets the index of the current player.
+     *
+     * @return the index of the current player.
+     */
+    unsigned getCurrentPlayerIndex() const { return currentPlayerIndex_; }
+
     /**
      * @brief Gets the piece position the current player has selected.
      *
@@ -146,6 +265,18 @@ public:
      */
     Player &getCurrentPlayer() { return players_.at(currentPlayerIndex_); }
 
+    /**
+     * @brief Gets the Zobrist key of this game state. It covers the maze (see
+     * Maze::getKey), the players positions and progress, the current player
+     * and his/ her turn phase.
+     *
+     * The key of the maze cards is maintained incrementally, the players part
+     * is made of a few table reads.
+     *
+     * @return the key of this game state.
+     */
+    std::uint64_t getKey() const;
+
     /**
      * @brief Gets the winner of this game. The winner is the first player to
      * find all of his/ her objectives and return to his/ her initial position.
@@ -173,10 +304,18 @@ public:
      * @brief Gets the position of the given objective.
      *
      * @param o is the objective to get the position for.
-     * @return the position of the given object.
+     * @return the position of the given object, or (0; 0) when the object is
+     * on the current maze card.
      */
     MazePosition getObjectivePosition(const Object &o) const;
 
+    /**
+     * @brief Gets the players standing on each cell of the maze.
+     *
+     * @return the occupancy index of this game.
+     */
+    const Occupancy &getOccupancy() const { return occupancy_; }
+
     /**
      * @brief Gets the player(s) at a given position of the maze.
      *
@@ -187,8 +326,31 @@ public:
 
     /**
      * @brief Starts this game.
+     *
+     * @param nbOfPlayer is the number of player of this game.
+     * @param engine is the random engine used to deal the objectives.
      */
-    void start(unsigned nbOfPlayer);
+    void start(unsigned nbOfPlayer, RandomEngine &engine);
+
+    /**
+     * @brief Gets the positions the current player can reach from his/ her
+     * position.
+     *
+     * @return the positions reachable by the current player.
+     */
+    CellSet getReachablePositions() const {
+        return maze_.reachableFrom(players_.at(currentPlayerIndex_).getPosition());
+    }
+
+    /**
+     * @brief Fills one field per player with the length of the shortest walk
+     * from his/ her position to every cell of the maze. The fields are filled
+     * at once, sharing the links of the pathways.
+     *
+     * @param fields are getNbOfPlayers fields, filled in the order of the
+     * players.
+     */
+    void computePlayerDistances(DistanceField *fields) const;
 
     /**
      * @brief Selects the position of the current player.
@@ -204,6 +366,49 @@ public:
      */
     void selectInsertionPosition(const MazePosition &position);
 
+    /**
+     * @brief Turns the current objective of the current player over if he/ she
+     * is standing on it, and sets his/ her next objective.
+     *
+     * @return true if the current player has found his/ her objective.
+     */
+    bool collectObjective();
+
+    /**
+     * @brief Plays a complete turn for the current player: the current maze
+     * card is rotated and inserted, the current player moves, collects his/
+     * her objective if found, and the hand is passed to the next player. The
+     * observers are updated once, at the end of the turn.
+     *
+     * @param turn is the turn to play.
+     * @return true if the current player has found his/ her objective.
+     * @throws std::logic_error if the turn is not legal. The whole turn is
+     * checked before anything is played, so this game is then left unchanged
+     * and the observers are not notified.
+     */
+    bool playTurn(const Turn &turn);
+
+    /**
+     * @brief Applies a complete turn for the current player, like playTurn,
+     * and records what it changed. The observers are not notified: the turn is
+     * meant to be explored and undone by undoTurn.
+     *
+     * @param turn is the turn to apply.
+     * @return the record of the turn, to give back to undoTurn.
+     * @throws std::logic_error if the turn is not legal. This game is then left
+     * unchanged.
+     */
+    TurnRecord applyTurn(const Turn &turn);
+
+    /**
+     * @brief Undoes the last applied turn. This game is restored exactly as it
+     * was before applyTurn. The turns should be undone in the reverse order of
+     * their application.
+     *
+     * @param record is the record returned by applyTurn.
+     */
+    void undoTurn(const TurnRecord &record);
+
     /**
      * @brief Passes the hand
      */
@@ -212,6 +417,7 @@ public:
     /**
      * @brief Tells if this game is over. A game is over when one of the players
      * found all of his objectives and returned to his/ her initial position.
+     * The observers are not notified.
      *
      * @return true if this game is over.
      */
@@ -240,19 +446,29 @@ public:
      */
     void shiftPlayer();
 
+private:
+
     /**
-     * @brief shiftPlayerColumn shift the row player when inserting on
-     * maze's right or left side.
-     * @param player the player to shift.
+     * @brief Shifts the players standing on the line shifted by the last
+     * insertion, without notifying the observers.
+     */
+    void shiftPlayersOfLastInsertion();
+
+    /**
+     * @brief Turns the current objective of the current player over if he/ she
+     * is standing on it, without notifying the observers.
+     *
+     * @return true if the current player has found his/ her objective.
      */
-    void shiftPlayerRow(Player &player);
+    bool turnFoundObjectiveOver();
 
     /**
-     * @brief shiftPlayerColumn shift the column player when inserting on
-     * maze's up or down side.
-     * @param player the player to shift.
+     * @brief Constructs this game with a random engine only used during the
+     * construction.
      */
-    void shiftPlayerColumn(Player &player);
+    Game(unsigned nbOfPlayers, bool isSimplified, RandomEngine &&engine)
+        : Game{nbOfPlayers, isSimplified, engine}
+    {}
 };
 
 }}
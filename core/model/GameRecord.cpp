@@ -0,0 +1,298 @@
+#include "GameRecord.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "Game.h"
+#include "Maze.h"
+
+namespace labyrinth { namespace model {
+
+constexpr std::size_t GameRecord::FILE_HEADER_SIZE;
+constexpr std::size_t GameRecord::HEADER_SIZE;
+constexpr std::size_t GameRecord::LAYOUT_SIZE;
+constexpr unsigned GameRecord::MAX_NB_OF_TURNS;
+
+/**
+ * @brief Are the flags of a record.
+ */
+enum RecordFlag : std::uint8_t {
+    SIMPLIFIED = 1,
+    LAYOUT = 2,
+    OVER = 4
+};
+
+/**
+ * @brief Are the first bytes of a file of records.
+ */
+static const char MAGIC[4] = {'L', 'B', 'Y', 'R'};
+
+/**
+ * @brief Is the version of the format of the records.
+ */
+static constexpr std::uint8_t VERSION = 1;
+
+/**
+ * @brief Gets the number of bits needed to write the numbers lower than the
+ * given count.
+ */
+static constexpr unsigned getNbOfBits(unsigned count)
+{
+    return count <= 1 ? 0 : 1 + getNbOfBits((count + 1) / 2);
+}
+
+/**
+ * @brief Is the number of bits of the insertion slot of an encoded turn, the
+ * lowest ones.
+ */
+static constexpr unsigned SLOT_BITS = getNbOfBits(Maze::NB_OF_SLOTS);
+
+/**
+ * @brief Is the number of bits of the destination cell of an encoded turn, the
+ * highest ones. The rotation takes the 2 bits in between.
+ */
+static constexpr unsigned CELL_BITS = getNbOfBits(MazeBitboard::CELLS);
+
+static_assert(SLOT_BITS + 2 + CELL_BITS <= 16, "A turn should be encoded on 2 bytes.");
+
+static void writeInteger(std::string &bytes, std::uint64_t value, unsigned size)
+{
+    for (unsigned byte = 0; byte < size; ++byte) {
+        bytes += static_cast<char>((value >> (8 * byte)) & 0xFF);
+    }
+}
+
+static std::uint64_t readInteger(const unsigned char *data, unsigned size)
+{
+    std::uint64_t value = 0;
+    for (unsigned byte = 0; byte < size; ++byte) {
+        value |= std::uint64_t{data[byte]} << (8 * byte);
+    }
+    return value;
+}
+
+static void writeBitboard(std::string &bytes, Bitboard cells)
+{
+    for (unsigned word = 0; word < sizeof(Bitboard) / 8; ++word) {
+        writeInteger(bytes, static_cast<std::uint64_t>(cells >> (64 * word)), 8);
+    }
+}
+
+static Bitboard readBitboard(const unsigned char *&data)
+{
+    Bitboard cells = 0;
+    for (unsigned word = 0; word < sizeof(Bitboard) / 8; ++word) {
+        cells |= Bitboard{readInteger(data, 8)} << (64 * word);
+        data += 8;
+    }
+    return cells;
+}
+
+static void writeBytes(std::string &bytes, const std::uint8_t *values, std::size_t size)
+{
+    bytes.append(reinterpret_cast<const char *>(values), size);
+}
+
+static void readBytes(const unsigned char *&data, std::uint8_t *values, std::size_t size)
+{
+    std::memcpy(values, data, size);
+    data += size;
+}
+
+static void writeLayout(std::string &bytes, const GameState &layout)
+{
+    writeBitboard(bytes, layout.shiftedCells);
+    writeBitboard(bytes, layout.changedCells);
+    writeBytes(bytes, layout.shapes, sizeof(layout.shapes));
+    writeBytes(bytes, layout.objects, sizeof(layout.objects));
+    writeBytes(bytes, &layout.spareShape, 1);
+    writeBytes(bytes, &layout.spareObject, 1);
+    writeBytes(bytes, &layout.blockedCell, 1);
+    writeBytes(bytes, &layout.selectedInsertionCell, 1);
+    writeBytes(bytes, &layout.selectedPlayerCell, 1);
+    writeBytes(bytes, &layout.nbOfPlayers, 1);
+    writeBytes(bytes, &layout.currentPlayer, 1);
+    writeBytes(bytes, &layout.isSimplified, 1);
+    writeBytes(bytes, layout.playerCells, sizeof(layout.playerCells));
+    writeBytes(bytes, layout.playerStates, sizeof(layout.playerStates));
+    writeBytes(bytes, layout.nbOfFoundObjectives, sizeof(layout.nbOfFoundObjectives));
+    writeBytes(bytes, layout.objectives, sizeof(layout.objectives));
+}
+
+static void readLayout(const unsigned char *&data, GameState &layout)
+{
+    layout.shiftedCells = readBitboard(data);
+    layout.changedCells = readBitboard(data);
+    readBytes(data, layout.shapes, sizeof(layout.shapes));
+    readBytes(data, layout.objects, sizeof(layout.objects));
+    readBytes(data, &layout.spareShape, 1);
+    readBytes(data, &layout.spareObject, 1);
+    readBytes(data, &layout.blockedCell, 1);
+    readBytes(data, &layout.selectedInsertionCell, 1);
+    readBytes(data, &layout.selectedPlayerCell, 1);
+    readBytes(data, &layout.nbOfPlayers, 1);
+    readBytes(data, &layout.currentPlayer, 1);
+    readBytes(data, &layout.isSimplified, 1);
+    readBytes(data, layout.playerCells, sizeof(layout.playerCells));
+    readBytes(data, layout.playerStates, sizeof(layout.playerStates));
+    readBytes(data, layout.nbOfFoundObjectives, sizeof(layout.nbOfFoundObjectives));
+    readBytes(data, layout.objectives, sizeof(layout.objectives));
+}
+
+GameRecord::GameRecord(unsigned nbOfPlayers, bool isSimplified, unsigned seed)
+    : seed_{seed},
+      nbOfPlayers_{nbOfPlayers},
+      isSimplified_{isSimplified},
+      hasLayout_{false},
+      layout_{},
+      turns_{},
+      finalKey_{0},
+      isOver_{false}
+{}
+
+GameRecord::GameRecord(const GameState &layout)
+    : seed_{0},
+      nbOfPlayers_{layout.nbOfPlayers},
+      isSimplified_{layout.isSimplified != 0},
+      hasLayout_{true},
+      layout_(layout),
+      turns_{},
+      finalKey_{0},
+      isOver_{false}
+{}
+
+GameRecord::GameRecord()
+    : GameRecord{Game::MIN_NB_OF_PLAYERS, false, 0}
+{}
+
+Game GameRecord::createGame() const
+{
+    if (hasLayout_) return Game{layout_};
+    return Game{nbOfPlayers_, isSimplified_, seed_};
+}
+
+void GameRecord::addTurn(const Turn &turn)
+{
+    if (turns_.size() >= MAX_NB_OF_TURNS) {
+        throw std::length_error("A record cannot hold more than "
+                                + std::to_string(MAX_NB_OF_TURNS) + " turns.");
+    }
+    encodeTurn(turn);
+    turns_.push_back(turn);
+}
+
+void GameRecord::finish(const Game &game)
+{
+    finalKey_ = game.getKey();
+    isOver_ = game.isOver();
+}
+
+std::uint16_t GameRecord::encodeTurn(const Turn &turn)
+{
+    const std::array<MazePosition, Maze::NB_OF_SLOTS> &slots = Maze::getInsertionSlots();
+    unsigned slot = 0;
+    while (slot < slots.size() && !(slots[slot] == turn.insertion)) ++slot;
+    if (slot == slots.size() || !MazeBitboard::isInside(turn.destination)) {
+        throw std::invalid_argument("The turn cannot be recorded.");
+    }
+    unsigned cell = MazeBitboard::getCell(turn.destination);
+    return static_cast<std::uint16_t>(slot | (turn.rotation % 4) << SLOT_BITS
+                                      | cell << (SLOT_BITS + 2));
+}
+
+Turn GameRecord::decodeTurn(std::uint16_t code)
+{
+    unsigned slot = code & ((1u << SLOT_BITS) - 1);
+    unsigned cell = code >> (SLOT_BITS + 2);
+    if (slot >= Maze::NB_OF_SLOTS || cell >= MazeBitboard::CELLS) {
+        throw std::invalid_argument("The code " + std::to_string(code)
+                                    + " is not a turn.");
+    }
+    return Turn{Maze::getInsertionSlots()[slot], (code >> SLOT_BITS) & 0x3u,
+                MazeBitboard::getPosition(cell)};
+}
+
+void GameRecord::writeTo(std::string &bytes) const
+{
+    std::uint8_t flags = (isSimplified_ ? SIMPLIFIED : 0) | (hasLayout_ ? LAYOUT : 0)
+            | (isOver_ ? OVER : 0);
+    writeInteger(bytes, seed_, 4);
+    writeInteger(bytes, turns_.size(), 2);
+    writeInteger(bytes, nbOfPlayers_, 1);
+    writeInteger(bytes, flags, 1);
+    writeInteger(bytes, finalKey_, 8);
+    if (hasLayout_) writeLayout(bytes, layout_);
+    for (const Turn &turn : turns_) {
+        writeInteger(bytes, encodeTurn(turn), 2);
+    }
+}
+
+std::size_t GameRecord::getSize(const unsigned char *data, const unsigned char *end)
+{
+    if (end - data < static_cast<std::ptrdiff_t>(HEADER_SIZE)) {
+        throw std::invalid_argument("The record is truncated.");
+    }
+    std::size_t size = HEADER_SIZE + 2 * readInteger(data + 4, 2)
+            + (data[7] & LAYOUT ? LAYOUT_SIZE : 0);
+    if (static_cast<std::size_t>(end - data) < size) {
+        throw std::invalid_argument("The record is truncated.");
+    }
+    return size;
+}
+
+void GameRecord::readFrom(const unsigned char *&data, const unsigned char *end)
+{
+    const unsigned char *next = data + getSize(data, end);
+    std::uint8_t flags = data[7];
+    if (flags & ~(SIMPLIFIED | LAYOUT | OVER)) {
+        throw std::invalid_argument("The record has unknown flags.");
+    }
+    const unsigned char *turns = data + HEADER_SIZE;
+    seed_ = static_cast<unsigned>(readInteger(data, 4));
+    nbOfPlayers_ = data[6];
+    isSimplified_ = flags & SIMPLIFIED;
+    hasLayout_ = flags & LAYOUT;
+    isOver_ = flags & OVER;
+    finalKey_ = readInteger(data + 8, 8);
+    if (hasLayout_) {
+        readLayout(turns, layout_);
+        layout_.requireValid();
+        if (layout_.nbOfPlayers != nbOfPlayers_) {
+            throw std::invalid_argument("The layout of the record is not of its players.");
+        }
+    }
+    turns_.clear();
+    for (; turns < next; turns += 2) {
+        turns_.push_back(decodeTurn(static_cast<std::uint16_t>(readInteger(turns, 2))));
+    }
+    data = next;
+}
+
+void GameRecord::writeFileHeader(std::string &bytes)
+{
+    bytes.append(MAGIC, sizeof(MAGIC));
+    writeInteger(bytes, VERSION, 1);
+    writeInteger(bytes, MazeBitboard::SIZE, 1);
+    writeInteger(bytes, 0, 2);
+}
+
+const unsigned char *GameRecord::readFileHeader(const unsigned char *data,
+                                                const unsigned char *end)
+{
+    if (end - data < static_cast<std::ptrdiff_t>(FILE_HEADER_SIZE)
+            || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::invalid_argument("This is not a file of game records.");
+    }
+    if (data[4] != VERSION) {
+        throw std::invalid_argument("The version " + std::to_string(data[4])
+                                    + " of the records is not supported.");
+    }
+    unsigned size = data[5] != 0 ? data[5] : 7;
+    if (size != MazeBitboard::SIZE) {
+        throw std::invalid_argument("The records are of a maze of " + std::to_string(size)
+                                    + " by " + std::to_string(size) + ".");
+    }
+    return data + FILE_HEADER_SIZE;
+}
+
+}}
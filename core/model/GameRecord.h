@@ -0,0 +1,256 @@
+#ifndef GAMERECORD_H
+#define GAMERECORD_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GameState.h"
+#include "Turn.h"
+
+namespace labyrinth { namespace model {
+
+class Game;
+
+/**
+ * @brief Represents a played game in a compact binary form: how the game
+ * started, the turns played and a summary of the resulting state.
+ *
+ * A game starts either from the seed of its random engine or from an explicit
+ * layout. Each turn is stored on 2 bytes: the insertion slot, the rotation of
+ * the maze card and the destination cell, on as many bits as the size of the
+ * maze needs. A record of a seeded game thus
+ * takes 16 bytes plus 2 bytes per turn. All the numbers are little endian.
+ *
+ * A file of records starts with a header (see writeFileHeader) followed by
+ * the records, one after the other.
+ */
+class GameRecord
+{
+
+public:
+
+    /**
+     * @brief Is the size of the header of a file of records.
+     */
+    static constexpr std::size_t FILE_HEADER_SIZE = 8;
+
+    /**
+     * @brief Is the size of a record without its layout and its turns.
+     */
+    static constexpr std::size_t HEADER_SIZE = 16;
+
+    /**
+     * @brief Is the size of an explicit layout, 134 bytes for a maze of 7 by 7.
+     */
+    static constexpr std::size_t LAYOUT_SIZE = 2 * sizeof(Bitboard)
+            + sizeof(GameState::shapes) + sizeof(GameState::objects) + 8
+            + sizeof(GameState::playerCells) + sizeof(GameState::playerStates)
+            + sizeof(GameState::nbOfFoundObjectives) + sizeof(GameState::objectives);
+
+    /**
+     * @brief Is the maximum number of turns of a record.
+     */
+    static constexpr unsigned MAX_NB_OF_TURNS = 0xFFFF;
+
+private:
+
+    unsigned seed_;
+
+    unsigned nbOfPlayers_;
+
+    bool isSimplified_;
+
+    bool hasLayout_;
+
+    GameState layout_;
+
+    std::vector<Turn> turns_;
+
+    std::uint64_t finalKey_;
+
+    bool isOver_;
+
+public:
+
+    /**
+     * @brief Constructs the record of a game started from the given seed.
+     *
+     * @param nbOfPlayers is the number of players of the game.
+     * @param isSimplified tells if the game is simplified.
+     * @param seed is the seed the game was constructed with.
+     */
+    GameRecord(unsigned nbOfPlayers, bool isSimplified, unsigned seed);
+
+    /**
+     * @brief Constructs the record of a game started from the given state.
+     *
+     * @param layout is the state the game started from.
+     */
+    explicit GameRecord(const GameState &layout);
+
+    /**
+     * @brief Constructs the record of a game of 2 players started from seed 0,
+     * meant to be overwritten by readFrom.
+     */
+    GameRecord();
+
+    /**
+     * @brief Gets the seed the game was constructed with, 0 if it started
+     * from a layout.
+     *
+     * @return the seed of the game.
+     */
+    unsigned getSeed() const { return seed_; }
+
+    /**
+     * @brief Gets the number of players of the game.
+     *
+     * @return the number of players of the game.
+     */
+    unsigned getNbOfPlayers() const { return nbOfPlayers_; }
+
+    /**
+     * @brief Tells if the game is simplified.
+     *
+     * @return true if the game is simplified.
+     */
+    bool isSimplified() const { return isSimplified_; }
+
+    /**
+     * @brief Tells if the game started from an explicit layout rather than
+     * from a seed.
+     *
+     * @return true if the game started from getLayout.
+     */
+    bool hasLayout() const { return hasLayout_; }
+
+    /**
+     * @brief Gets the state the game started from, if hasLayout.
+     *
+     * @return the initial layout of the game.
+     */
+    const GameState &getLayout() const { return layout_; }
+
+    /**
+     * @brief Gets the turns played, in order.
+     *
+     * @return the turns of the game.
+     */
+    const std::vector<Turn> &getTurns() const { return turns_; }
+
+    /**
+     * @brief Gets the Zobrist key of the game once every turn is played (see
+     * Game::getKey).
+     *
+     * @return the key of the final state of the game.
+     */
+    std::uint64_t getFinalKey() const { return finalKey_; }
+
+    /**
+     * @brief Tells if the game was over once every turn was played.
+     *
+     * @return true if the recorded game is over.
+     */
+    bool isOver() const { return isOver_; }
+
+    /**
+     * @brief Constructs the game as it was before the first turn.
+     *
+     * @return the initial game of this record.
+     * @throws std::logic_error if the record has no valid number of players.
+     */
+    Game createGame() const;
+
+    /**
+     * @brief Adds a turn to this record.
+     *
+     * @param turn is the turn played.
+     * @throws std::length_error if this record already has MAX_NB_OF_TURNS
+     * turns.
+     * @throws std::invalid_argument if the turn is not an insertion slot and a
+     * position of the maze.
+     */
+    void addTurn(const Turn &turn);
+
+    /**
+     * @brief Records the state of the given game as the final state.
+     *
+     * @param game is the game once every turn is played.
+     */
+    void finish(const Game &game);
+
+    /**
+     * @brief Encodes the given turn on 2 bytes.
+     *
+     * @param turn is the turn to encode.
+     * @return the encoded turn.
+     * @throws std::invalid_argument if the turn is not an insertion slot and a
+     * position of the maze.
+     */
+    static std::uint16_t encodeTurn(const Turn &turn);
+
+    /**
+     * @brief Decodes the given turn.
+     *
+     * @param code is the turn encoded by encodeTurn.
+     * @return the decoded turn, with a rotation between 0 and 3.
+     * @throws std::invalid_argument if the code is not a valid turn.
+     */
+    static Turn decodeTurn(std::uint16_t code);
+
+    /**
+     * @brief Appends this record to the given bytes.
+     *
+     * @param bytes are the bytes to append to.
+     */
+    void writeTo(std::string &bytes) const;
+
+    /**
+     * @brief Replaces this record by the one starting at the given bytes. The
+     * memory of the turns is reused.
+     *
+     * @param data is the beginning of the record, moved to its end.
+     * @param end is the end of the readable bytes.
+     * @throws std::invalid_argument if the bytes are not a complete record, or
+     * if its layout is not a valid state (see GameState::requireValid).
+     */
+    void readFrom(const unsigned char *&data, const unsigned char *end);
+
+    /**
+     * @brief Gets the size of the record starting at the given bytes, without
+     * decoding it.
+     *
+     * @param data is the beginning of the record.
+     * @param end is the end of the readable bytes.
+     * @return the size of the record.
+     * @throws std::invalid_argument if the bytes are not a complete record.
+     */
+    static std::size_t getSize(const unsigned char *data, const unsigned char *end);
+
+    /**
+     * @brief Appends the header of a file of records to the given bytes. The
+     * header tells the size of the maze, as the records of a size cannot be
+     * replayed with another.
+     *
+     * @param bytes are the bytes to append to.
+     */
+    static void writeFileHeader(std::string &bytes);
+
+    /**
+     * @brief Checks the header of a file of records.
+     *
+     * @param data is the beginning of the file.
+     * @param end is the end of the file.
+     * @return the beginning of the first record.
+     * @throws std::invalid_argument if the file does not start with a valid
+     * header or its records are of another size of maze.
+     */
+    static const unsigned char *readFileHeader(const unsigned char *data,
+                                               const unsigned char *end);
+
+};
+
+}}
+
+#endif // GAMERECORD_H
@@ -0,0 +1,130 @@
+#include "GameState.h"
+#include "Game.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace labyrinth { namespace model {
+
+constexpr unsigned GameState::NB_OF_OBJECTIVES;
+
+GameState::GameState(const Game &game)
+    : shiftedCells{game.getMaze().getLastShiftedCells().getCells()},
+      changedCells{game.getMaze().getLastChangedCells().getCells()},
+      shapes{},
+      objects{},
+      spareShape{0},
+      spareObject{NONE},
+      blockedCell{0},
+      selectedInsertionCell{0},
+      selectedPlayerCell{0},
+      nbOfPlayers{static_cast<std::uint8_t>(game.getNbOfPlayers())},
+      currentPlayer{static_cast<std::uint8_t>(game.getCurrentPlayerIndex())},
+      isSimplified{game.isSimplified()},
+      playerCells{},
+      playerStates{},
+      nbOfFoundObjectives{},
+      objectives{}
+{
+    const Maze &maze = game.getMaze();
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        const MazeCard &card = maze.getCardAt(MazeBitboard::getPosition(cell));
+        setShape(cell, card.getShape().getValue());
+        objects[cell] = static_cast<std::uint8_t>(card.getObject());
+    }
+    const MazeCard &spare = maze.getLastPushedOutMazeCard();
+    spareShape = static_cast<std::uint8_t>(spare.getShape().getValue());
+    spareObject = static_cast<std::uint8_t>(spare.getObject());
+    blockedCell = static_cast<std::uint8_t>(
+                MazeBitboard::getCell(maze.getLastPushedOutMazePosition()));
+    selectedInsertionCell = static_cast<std::uint8_t>(
+                MazeBitboard::getCell(game.getSelectedInsertionPosition()));
+    selectedPlayerCell = static_cast<std::uint8_t>(
+                MazeBitboard::getCell(game.getSelectedPlayerPosition()));
+
+    unsigned objective = 0;
+    for (unsigned index = 0; index < nbOfPlayers; ++index) {
+        const Player &player = game.getPlayer(index);
+        playerCells[index] = static_cast<std::uint8_t>(
+                    MazeBitboard::getCell(player.getPosition()));
+        playerStates[index] = static_cast<std::uint8_t>(player.getState());
+        nbOfFoundObjectives[index] = static_cast<std::uint8_t>(
+                    player.getNbOfFoundObjectives());
+        for (const ObjectCard &card : player.getObjectives().getCards()) {
+            objectives[objective++] = static_cast<std::uint8_t>(card.getObject());
+        }
+    }
+}
+
+/**
+ * @brief Checks that the given field of a state is not above the given bound.
+ */
+static void requireAtMost(unsigned value, unsigned bound, const char *field)
+{
+    if (value > bound) {
+        throw std::invalid_argument(std::string{"Invalid game state! "} + field + " is "
+                                    + std::to_string(value) + " but should be at most "
+                                    + std::to_string(bound) + ".");
+    }
+}
+
+void GameState::requireValid() const
+{
+    const unsigned lastCell = MazeBitboard::CELLS - 1;
+    if ((shiftedCells & ~MazeBitboard::ALL) != 0 || (changedCells & ~MazeBitboard::ALL) != 0) {
+        throw std::invalid_argument("Invalid game state! The last insertion has cells"
+                                    " outside of the maze.");
+    }
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        MazeCardShape{getShape(cell)}.getValue();
+        requireAtMost(objects[cell], NONE, "an object of the maze");
+    }
+    MazeCardShape{spareShape}.getValue();
+    requireAtMost(spareObject, NONE, "the object of the spare card");
+    requireAtMost(blockedCell, lastCell, "the blocked cell");
+    requireAtMost(selectedInsertionCell, lastCell, "the selected insertion cell");
+    requireAtMost(selectedPlayerCell, lastCell, "the selected player cell");
+    if (nbOfPlayers < 2 || 4 < nbOfPlayers) {
+        throw std::invalid_argument(std::to_string(nbOfPlayers)
+                                    + " is not a valid number of player!");
+    }
+    requireAtMost(currentPlayer, nbOfPlayers - 1u, "the current player");
+    const unsigned nbOfCards = NB_OF_OBJECTIVES / nbOfPlayers;
+    for (unsigned player = 0; player < nbOfPlayers; ++player) {
+        requireAtMost(playerCells[player], lastCell, "the cell of a player");
+        requireAtMost(playerStates[player], static_cast<unsigned>(Player::State::DONE),
+                      "the phase of a player");
+        requireAtMost(nbOfFoundObjectives[player], nbOfCards,
+                      "the number of objectives found by a player");
+    }
+    for (unsigned objective = 0; objective < nbOfPlayers * nbOfCards; ++objective) {
+        requireAtMost(objectives[objective], NONE - 1u, "an objective");
+    }
+}
+
+bool operator==(const GameState &lhs, const GameState &rhs)
+{
+    return lhs.shiftedCells == rhs.shiftedCells
+            && lhs.changedCells == rhs.changedCells
+            && std::equal(std::begin(lhs.shapes), std::end(lhs.shapes), rhs.shapes)
+            && std::equal(std::begin(lhs.objects), std::end(lhs.objects), rhs.objects)
+            && lhs.spareShape == rhs.spareShape
+            && lhs.spareObject == rhs.spareObject
+            && lhs.blockedCell == rhs.blockedCell
+            && lhs.selectedInsertionCell == rhs.selectedInsertionCell
+            && lhs.selectedPlayerCell == rhs.selectedPlayerCell
+            && lhs.nbOfPlayers == rhs.nbOfPlayers
+            && lhs.currentPlayer == rhs.currentPlayer
+            && lhs.isSimplified == rhs.isSimplified
+            && std::equal(std::begin(lhs.playerCells), std::end(lhs.playerCells),
+                          rhs.playerCells)
+            && std::equal(std::begin(lhs.playerStates), std::end(lhs.playerStates),
+                          rhs.playerStates)
+            && std::equal(std::begin(lhs.nbOfFoundObjectives),
+                          std::end(lhs.nbOfFoundObjectives), rhs.nbOfFoundObjectives)
+            && std::equal(std::begin(lhs.objectives), std::end(lhs.objectives),
+                          rhs.objectives);
+}
+
+}}
@@ -0,0 +1,182 @@
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "MazeBitboard.h"
+
+namespace labyrinth { namespace model {
+
+class Game;
+
+/**
+ * @brief Represents the whole state of a game as a fixed size, trivially
+ * copyable value. Copying a state is a plain memory copy, so states can be
+ * stacked by a search or handed to another thread cheaply. A game converts
+ * losslessly to and from a state.
+ *
+ * The cells are indexed as in MazeBitboard: row * MazeBitboard::SIZE + column.
+ */
+struct GameState
+{
+
+    /**
+     * @brief Is the total number of objectives dealt to the players.
+     */
+    static constexpr unsigned NB_OF_OBJECTIVES = 24;
+
+    /**
+     * @brief Are the cells of the line shifted by the last insertion.
+     */
+    Bitboard shiftedCells;
+
+    /**
+     * @brief Are the cells whose card or links changed with the last insertion.
+     */
+    Bitboard changedCells;
+
+    /**
+     * @brief Are the shapes of the cards of the maze, two cells per byte, the
+     * even cell in the low half.
+     */
+    std::uint8_t shapes[(MazeBitboard::CELLS + 1) / 2];
+
+    /**
+     * @brief Are the objects of the cards of the maze.
+     */
+    std::uint8_t objects[MazeBitboard::CELLS];
+
+    /**
+     * @brief Is the shape of the last pushed out card.
+     */
+    std::uint8_t spareShape;
+
+    /**
+     * @brief Is the object of the last pushed out card.
+     */
+    std::uint8_t spareObject;
+
+    /**
+     * @brief Is the cell the last pushed out card left, where no card can be
+     * inserted.
+     */
+    std::uint8_t blockedCell;
+
+    /**
+     * @brief Is the position selected to insert the current maze card at.
+     */
+    std::uint8_t selectedInsertionCell;
+
+    /**
+     * @brief Is the position selected to move the current player to.
+     */
+    std::uint8_t selectedPlayerCell;
+
+    /**
+     * @brief Is the number of players, between 2 and 4.
+     */
+    std::uint8_t nbOfPlayers;
+
+    /**
+     * @brief Is the index of the current player.
+     */
+    std::uint8_t currentPlayer;
+
+    /**
+     * @brief Tells if the game is simplified.
+     */
+    std::uint8_t isSimplified;
+
+    /**
+     * @brief Are the cells of the players.
+     */
+    std::uint8_t playerCells[4];
+
+    /**
+     * @brief Are the phases of the turn of the players (see Player::State).
+     */
+    std::uint8_t playerStates[4];
+
+    /**
+     * @brief Are the numbers of objectives found by the players. The
+     * objectives are found in the order of the decks.
+     */
+    std::uint8_t nbOfFoundObjectives[4];
+
+    /**
+     * @brief Are the decks of the players, one after the other, each of 24 /
+     * nbOfPlayers objectives.
+     */
+    std::uint8_t objectives[NB_OF_OBJECTIVES];
+
+    /**
+     * @brief Constructs an empty state.
+     */
+    GameState() = default;
+
+    /**
+     * @brief Constructs the state of the given game.
+     *
+     * @param game is the game to get the state of.
+     */
+    explicit GameState(const Game &game);
+
+    /**
+     * @brief Checks that this state can be restored: every cell, object,
+     * player and phase is in its range. A state read from outside of the
+     * program, e.g. from a record, should be checked before being restored.
+     *
+     * @throws std::invalid_argument if a field of this state is out of its
+     * range.
+     */
+    void requireValid() const;
+
+    /**
+     * @brief Gets the shape of the card of the given cell.
+     *
+     * @param cell is the index of the cell.
+     * @return the value of the maze card shape of the cell.
+     */
+    unsigned getShape(unsigned cell) const {
+        return (shapes[cell / 2] >> (cell % 2 * 4)) & 0xF;
+    }
+
+    /**
+     * @brief Sets the shape of the card of the given cell.
+     *
+     * @param cell is the index of the cell.
+     * @param shape is the value of a maze card shape.
+     */
+    void setShape(unsigned cell, unsigned shape) {
+        unsigned offset = cell % 2 * 4;
+        shapes[cell / 2] = static_cast<std::uint8_t>(
+                    (shapes[cell / 2] & ~(0xF << offset)) | ((shape & 0xF) << offset));
+    }
+
+};
+
+static_assert(std::is_trivially_copyable<GameState>::value,
+              "A game state should be copied as plain memory.");
+
+/**
+ * @brief Is the largest size of a game state, in bytes. The 7 x 7 maze keeps
+ * the budget of 256 bytes. The cards of the bigger mazes take one byte and a
+ * half per cell more, and their 128 bits bitboards align the state on 16
+ * bytes, so the 11 x 11 maze needs 272 bytes and gets a budget of 320.
+ */
+constexpr std::size_t MAX_GAME_STATE_SIZE = MazeBitboard::SIZE <= 7 ? 256 : 320;
+
+static_assert(sizeof(GameState) <= MAX_GAME_STATE_SIZE,
+              "A game state should stay small.");
+
+bool operator==(const GameState &lhs, const GameState &rhs);
+
+inline bool operator!=(const GameState &lhs, const GameState &rhs) {
+    return !(lhs == rhs);
+}
+
+}}
+
+#endif // GAMESTATE_H
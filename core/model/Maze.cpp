@@ -1,52 +1,53 @@
 #include "Maze.h"
 #include "MazeDirection.h"
 #include "MazeCardsBuilder.h"
+#include "Zobrist.h"
+#include "GameState.h"
 
-#include <array>
 #include <iostream>
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
-#include <ctime>
+#include <cassert>
 
 using namespace std;
 
 namespace labyrinth { namespace model {
 
+constexpr unsigned Maze::SIZE;
+constexpr unsigned Maze::NB_OF_SLOTS;
+constexpr unsigned Maze::SPARE_CELL;
+constexpr unsigned Maze::NO_CELL;
+
 static bool isSteadyCardPosition(unsigned row, unsigned column)
 {
     return row % 2 == 0 && column % 2 == 0;
 }
 
-static int getRandomRotation() {
-    return rand() % 4;
-}
-
-static void randomlyRotate(std::vector<MazeCard> &movableCards) {
+static void randomlyRotate(std::vector<MazeCard> &movableCards, RandomEngine &engine) {
+    std::uniform_int_distribution<int> rotations{0, 3};
     for (auto &card : movableCards) {
-        for (int rotation = 0; rotation < getRandomRotation(); ++rotation) {
-            card.rotate();
-        }
+        card.rotate(static_cast<unsigned>(rotations(engine)));
     }
 }
 
-static void buildCards(std::vector<MazeCard> &steady, std::vector<MazeCard> &movable)
+static void buildCards(std::vector<MazeCard> &steady, std::vector<MazeCard> &movable,
+                       RandomEngine &engine)
 {
     MazeCardsBuilder builder;
-    srand(static_cast<unsigned>(time(nullptr)));
     builder.getSteadyCards(steady);
     builder.getMovableCards(movable);
-    random_shuffle(movable.begin(), movable.end());
-    randomlyRotate(movable);
+    shuffle(movable.begin(), movable.end(), engine);
+    randomlyRotate(movable, engine);
 }
 
-void Maze::initializeCards()
+void Maze::initializeCards(RandomEngine &engine)
 {
     std::vector<MazeCard> steadyCards;
     std::vector<MazeCard> movableCards;
     unsigned currentSteady = 0;
     unsigned currentMovable = 0;
-    buildCards(steadyCards, movableCards);
+    buildCards(steadyCards, movableCards, engine);
     for (unsigned row = 0; row < SIZE; ++row) {
         for (unsigned column = 0; column < SIZE; ++column) {
             if (isSteadyCardPosition(row, column)) {
@@ -61,101 +62,189 @@ void Maze::initializeCards()
     lastPushedOutMazeCard_ = movableCards.at(currentMovable);
 }
 
-void Maze::initializeAdjacency()
+static CellSet getLineOf(const MazePosition &position, bool isRow)
+{
+    Bitboard line = 0;
+    for (unsigned i = 0; i < Maze::SIZE; ++i) {
+        line |= MazeBitboard::getBit(isRow ? position.getRow() * Maze::SIZE + i
+                                           : i * Maze::SIZE + position.getColumn());
+    }
+    return CellSet{line};
+}
+
+void Maze::initialize(RandomEngine &engine) {
+    initializeCards(engine);
+    updateAdjacency();
+    cardsKey_ = computeCardsKey();
+    indexObjects();
+}
+
+Maze::Maze(const GameState &state)
+    : lastPushedOutMazeCard_{MazeCardShape{state.spareShape}, true,
+                             static_cast<Object>(state.spareObject)},
+      lastPushedOutCell_{state.blockedCell},
+      lastShiftedCells_{state.shiftedCells},
+      lastChangedCells_{state.changedCells}
 {
     for (unsigned row = 0; row < SIZE; ++row) {
         for (unsigned column = 0; column < SIZE; ++column) {
-            auto adj{make_pair(MazePosition{row, column}, vector<MazePosition>())};
-            adjacencies_.insert(adj);
+            unsigned cell = row * SIZE + column;
+            cards_[row][column] = MazeCard{MazeCardShape{state.getShape(cell)},
+                                           !isSteadyCardPosition(row, column),
+                                           static_cast<Object>(state.objects[cell])};
         }
     }
+    updateAdjacency();
+    cardsKey_ = computeCardsKey();
+    indexObjects();
 }
 
-void Maze::initialize() {
-    initializeAdjacency();
-    initializeCards();
-    updateAdjacency();
+void Maze::indexObjects()
+{
+    for (unsigned object = 0; object < NONE; ++object) {
+        objectCells_[object] = NO_CELL;
+    }
+    for (unsigned row = 0; row < SIZE; ++row) {
+        for (unsigned column = 0; column < SIZE; ++column) {
+            setObjectCell(cards_[row][column], row * SIZE + column);
+        }
+    }
+    setObjectCell(lastPushedOutMazeCard_, SPARE_CELL);
 }
 
-bool Maze::existDirectPathBetween(const MazePosition &lhs, const MazePosition &rhs) const
+void Maze::setCardAt(const MazePosition &position, const MazeCard &card)
 {
-    MazeCard lhs_card = getCardAt(lhs);
-    MazeCard rhs_card = getCardAt(rhs);
-    return lhs_card.isGoing(lhs.getDirectionTo(rhs))
-            && rhs_card.isGoing(rhs.getDirectionTo(lhs));
+    unsigned cell = MazeBitboard::getCell(position);
+    Object replaced = getCardAt(position).getObject();
+    if (replaced != NONE && objectCells_[replaced] == cell) {
+        objectCells_[replaced] = NO_CELL;
+    }
+    cardsKey_ ^= getCardKeyOf(MazeCell{cell});
+    cards_[position.getRow()][position.getColumn()] = card;
+    cardsKey_ ^= getCardKeyOf(MazeCell{cell});
+    pathways_.setShape(cell, card.getShape().getValue());
+    setObjectCell(card, cell);
 }
 
-bool Maze::areAdjacent(const MazePosition &lhs, const MazePosition &rhs) const
+std::uint64_t Maze::getCardKeyOf(MazeCell cell) const
 {
-    auto it = adjacencies_.find(lhs);
-    if (it != adjacencies_.end()) {
-        std::vector<MazePosition> adjacents = it->second;
-        return std::find(adjacents.begin(), adjacents.end(), rhs) != adjacents.end();
-    } else {
-        throw std::invalid_argument("lhs has not been found.\n");
+    const MazeCard &card = getCardOf(cell);
+    return Zobrist::getCardKey(cell.getIndex(), card.getShape().getValue(), card.getObject());
+}
+
+std::uint64_t Maze::computeCardsKey() const
+{
+    std::uint64_t key = 0;
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        key ^= getCardKeyOf(MazeCell{cell});
     }
+    return key;
 }
 
-std::vector<MazePosition> Maze::getNeighbors(const MazePosition &pos) const {
-    auto it = adjacencies_.find(pos);
-    if (it != adjacencies_.end()) {
-        return it->second;
-    } else {
-        throw std::invalid_argument("The given position has not been found.\n");
+void Maze::toggleCardKeysOf(const CellSet &cells)
+{
+    for (Bitboard remaining = cells.getCells(); remaining; remaining &= remaining - 1) {
+        cardsKey_ ^= getCardKeyOf(MazeCell{getLowestCell(remaining)});
     }
 }
 
-static array<array<bool, 7>, 7> getVisits() {
-    array<array<bool, 7>, 7> visits;
-    for (unsigned row = 0; row < 7; ++row) {
-        for (unsigned column = 0; column < 7; ++column) {
-            visits[row][column] = false;
-        }
+std::uint64_t Maze::getKey() const
+{
+    return cardsKey_
+            ^ Zobrist::getSpareCardKey(lastPushedOutMazeCard_.getShape().getValue(),
+                                       lastPushedOutMazeCard_.getObject())
+            ^ Zobrist::getBlockedKey(lastPushedOutCell_.getIndex());
+}
+
+void Maze::requireInside(const MazePosition &position, const char *message)
+{
+    if (!MazeBitboard::isInside(position)) {
+        throw std::invalid_argument(message);
     }
-    return visits;
 }
 
-static bool recExistPathBetween(const MazePosition &src, const MazePosition &dest,
-                                const Maze & maze, array<array<bool, 7>, 7> &M)
+bool Maze::existDirectPathBetween(const MazePosition &lhs, const MazePosition &rhs) const
 {
-    if (src == dest || maze.areAdjacent(src, dest)) {
-        return true;
-    } else {
-        std::vector<MazePosition> neighbors = maze.getNeighbors(src);
-        for (auto & neighbor : neighbors) {
-            bool isVisited = M[neighbor.getRow()][neighbor.getColumn()];
-            M[src.getRow()][src.getColumn()] = true;
-            if (!isVisited && recExistPathBetween(neighbor, dest, maze, M)) {
-                return true;
-            }
-        }
+    MazeDirection direction = lhs.getDirectionTo(rhs);
+    requireInside(lhs, "lhs is out of the maze.\n");
+    requireInside(rhs, "rhs is out of the maze.\n");
+    return pathways_.isLinked(MazeBitboard::getCell(lhs), direction);
+}
+
+bool Maze::areAdjacent(const MazePosition &lhs, const MazePosition &rhs) const
+{
+    requireInside(lhs, "lhs has not been found.\n");
+    if (!MazeBitboard::isInside(rhs)) {
         return false;
     }
+    Bitboard neighbors = pathways_.getNeighbors(MazeBitboard::getCell(lhs));
+    return neighbors & MazeBitboard::getBit(MazeBitboard::getCell(rhs));
+}
+
+std::vector<MazePosition> Maze::getNeighbors(const MazePosition &pos) const {
+    requireInside(pos, "The given position has not been found.\n");
+    std::vector<MazePosition> neighbors;
+    MazeCell cell = MazeCell::of(pos);
+    for (MazeDirection dir = UP; dir <= LEFT; ++dir) {
+        if (pathways_.isLinked(cell.getIndex(), dir)) {
+            neighbors.push_back(cell.getNeighbor(dir).getPosition());
+        }
+    }
+    return neighbors;
+}
+
+CellSet Maze::reachableFrom(const MazePosition &position) const
+{
+    requireInside(position, "The given position has not been found.\n");
+    Bitboard source = MazeBitboard::getBit(MazeBitboard::getCell(position));
+    return CellSet{pathways_.getReachable(source)};
 }
 
 bool Maze::existPathBetween(const MazePosition &src, const MazePosition &dest) const
 {
-    array<array<bool, 7>, 7> visits = getVisits();
-    return recExistPathBetween(src, dest, *this, visits);
+    requireInside(dest, "The destination position has not been found.\n");
+    return reachableFrom(src).contains(dest);
 }
 
-void Maze::updateAdjacency()
+void Maze::computeDistancesFrom(const MazePosition &position, DistanceField &field) const
 {
-    for (auto &adjacency : adjacencies_) {
-        MazePosition position = adjacency.first;
-        std::vector<MazePosition> &neighbors = adjacency.second;
-        neighbors.clear();
-        for (MazeDirection dir = UP; dir <= LEFT; ++dir) {
-            if (position.hasNeighbor(dir)) {
-                MazePosition neighbor = position.getNeighbor(dir);
-                if (existDirectPathBetween(position, neighbor)) {
-                    neighbors.push_back(neighbor);
-                }
-            }
+    requireInside(position, "The given position has not been found.\n");
+    field.compute(pathways_, MazeBitboard::getBit(MazeBitboard::getCell(position)));
+}
+
+MazeBitboard Maze::buildPathways() const
+{
+    MazeBitboard pathways;
+    for (unsigned row = 0; row < SIZE; ++row) {
+        for (unsigned column = 0; column < SIZE; ++column) {
+            pathways.setShape(row * SIZE + column,
+                              cards_[row][column].getShape().getValue());
         }
     }
+    return pathways;
 }
 
+void Maze::updateAdjacency()
+{
+    pathways_ = buildPathways();
+}
+
+void Maze::updatePathwaysOf(const CellSet &cells)
+{
+    Bitboard right = pathways_.getLinks(RIGHT);
+    Bitboard down = pathways_.getLinks(DOWN);
+    for (Bitboard remaining = cells.getCells(); remaining; remaining &= remaining - 1) {
+        MazeCell cell{getLowestCell(remaining)};
+        pathways_.setShape(cell.getIndex(), getCardOf(cell).getShape().getValue());
+    }
+    right ^= pathways_.getLinks(RIGHT);
+    down ^= pathways_.getLinks(DOWN);
+    lastChangedCells_ = CellSet{cells.getCells() | right | (right << 1)
+            | down | (down << SIZE)};
+    assert(pathways_ == buildPathways());
+}
+
+
 bool Maze::isOnSide(const MazePosition &pos, const MazeDirection direction) const
 {
     switch (direction)
@@ -180,18 +269,61 @@ bool Maze::isOnASide(const MazePosition &position) const
 
 void Maze::requireInserrable(const MazePosition &position) const
 {
-    if (!isOnASide(position)) {
+    if (!isOnASide(position) || !MazeBitboard::isInside(position)) {
         throw std::logic_error("An inserrable position should be on a side.");
     }
     if(!getCardAt(position).isMovable()){
         throw std::logic_error("This is not allowed to insert at the given position!");
     }
-    if (position == lastPushedOutPosition_) {
+    if (position == lastPushedOutCell_.getPosition()) {
         throw std::logic_error("Trying to push the maze card at the same place!");
     }
 }
 
-MazePosition Maze::getOpposite(const MazePosition &pos)
+bool Maze::isInserrable(const MazePosition &position) const
+{
+    return isOnASide(position) && MazeBitboard::isInside(position)
+            && getCardAt(position).isMovable()
+            && !(position == lastPushedOutCell_.getPosition());
+}
+
+static std::array<MazePosition, Maze::NB_OF_SLOTS> buildInsertionSlots()
+{
+    std::array<MazePosition, Maze::NB_OF_SLOTS> slots;
+    unsigned slot = 0;
+    for (unsigned i = 1; i < Maze::SIZE; i += 2) {
+        slots[slot++] = MazePosition{0, i};
+        slots[slot++] = MazePosition{i, Maze::SIZE - 1};
+        slots[slot++] = MazePosition{Maze::SIZE - 1, i};
+        slots[slot++] = MazePosition{i, 0};
+    }
+    return slots;
+}
+
+const std::array<MazePosition, Maze::NB_OF_SLOTS> &Maze::getInsertionSlots()
+{
+    static const std::array<MazePosition, NB_OF_SLOTS> slots = buildInsertionSlots();
+    return slots;
+}
+
+MazePosition Maze::getShiftedPosition(const MazePosition &position,
+                                      const MazePosition &slot) const
+{
+    unsigned row = position.getRow();
+    unsigned column = position.getColumn();
+    if (isOnSide(slot, UP) && column == slot.getColumn()) {
+        row = (row + 1) % SIZE;
+    } else if (isOnSide(slot, DOWN) && column == slot.getColumn()) {
+        row = (row + SIZE - 1) % SIZE;
+    } else if (isOnSide(slot, LEFT) && row == slot.getRow()) {
+        column = (column + 1) % SIZE;
+    } else if (isOnSide(slot, RIGHT) && row == slot.getRow()) {
+        column = (column + SIZE - 1) % SIZE;
+    }
+    return MazePosition{row, column};
+}
+
+MazePosition Maze::getOpposite(const MazePosition &pos) const
 {
     if(pos.getRow() == 0){
         return MazePosition{SIZE-1,pos.getColumn()};
@@ -209,25 +341,51 @@ MazePosition Maze::getOpposite(const MazePosition &pos)
 
 MazeCard Maze::insertLastPushedOutMazeCardAt(const MazePosition &position)
 {
-    MazeCard pushedOutMazeCard;
     requireInserrable(position);
+    return shiftLineFrom(position);
+}
+
+void Maze::undoInsertionAt(const MazePosition &position,
+                           const MazePosition &blockedPosition,
+                           const CellSet &shiftedCells, const CellSet &changedCells)
+{
+    shiftLineFrom(getOpposite(position));
+    lastPushedOutCell_ = MazeCell::of(blockedPosition);
+    lastShiftedCells_ = shiftedCells;
+    lastChangedCells_ = changedCells;
+}
+
+MazeCard Maze::shiftLineFrom(const MazePosition &position)
+{
+    MazeCard pushedOutMazeCard;
+    CellSet line = getLineOf(position, isOnSide(position, LEFT)
+                             || isOnSide(position, RIGHT));
+    toggleCardKeysOf(line);
     if (isOnSide(position, UP)) {
         insertUpSide(pushedOutMazeCard, position);
-        lastPushedOutPosition_ = getOpposite(position);
+        lastPushedOutCell_ = MazeCell::of(getOpposite(position));
     } else if (isOnSide(position, DOWN)) {
         insertDownSide(pushedOutMazeCard, position);
-        lastPushedOutPosition_ = getOpposite(position);
+        lastPushedOutCell_ = MazeCell::of(getOpposite(position));
     } else if (isOnSide(position, LEFT)) {
         insertLeftSide(pushedOutMazeCard, position);
-        lastPushedOutPosition_ = getOpposite(position);
+        lastPushedOutCell_ = MazeCell::of(getOpposite(position));
     } else if (isOnSide(position, RIGHT)) {
         insertRightSide(pushedOutMazeCard, position);
-        lastPushedOutPosition_ = getOpposite(position);
+        lastPushedOutCell_ = MazeCell::of(getOpposite(position));
     } else {
         throw std::invalid_argument("The insertion should be on a side!");
     }
     cards_[position.getRow()][position.getColumn()] = lastPushedOutMazeCard_;
-    updateAdjacency();
+    toggleCardKeysOf(line);
+    assert(cardsKey_ == computeCardsKey());
+    lastShiftedCells_ = line;
+    updatePathwaysOf(lastShiftedCells_);
+    for (Bitboard remaining = line.getCells(); remaining; remaining &= remaining - 1) {
+        MazeCell shifted{getLowestCell(remaining)};
+        setObjectCell(getCardOf(shifted), shifted.getIndex());
+    }
+    setObjectCell(pushedOutMazeCard, SPARE_CELL);
     return lastPushedOutMazeCard_ = pushedOutMazeCard;
 }
 
@@ -240,8 +398,8 @@ void Maze::insertUpSide(MazeCard &ejected_card, const MazePosition &position){
 
 void Maze::insertDownSide(MazeCard &ejected_card, const MazePosition &position){
     ejected_card = cards_[0][position.getColumn()];
-    for(unsigned i{0}; i<SIZE; ++i){
-        cards_[i][position.getColumn()] = cards_[i+1][position.getRow()];
+    for(unsigned i{0}; i<SIZE-1; ++i){
+        cards_[i][position.getColumn()] = cards_[i+1][position.getColumn()];
     }
 }
 
@@ -254,7 +412,7 @@ void Maze::insertLeftSide(MazeCard &ejected_card, const MazePosition &position){
 
 void Maze::insertRightSide(MazeCard &ejected_card, const MazePosition &position){
     ejected_card = cards_[position.getRow()][0];
-    for(unsigned i{0}; i<SIZE; ++i){
+    for(unsigned i{0}; i<SIZE-1; ++i){
         cards_[position.getRow()][i] = cards_[position.getRow()][i+1];
     }
 }
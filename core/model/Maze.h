@@ -1,21 +1,45 @@
 #ifndef MAZE_H
 #define MAZE_H
 
-#include <map>
+#include <array>
+#include <cstdint>
 #include <vector>
 
 #include "MazePosition.h"
 #include "MazeCard.h"
+#include "MazeBitboard.h"
+#include "MazeCell.h"
+#include "CellSet.h"
+#include "DistanceField.h"
+#include "Object.h"
+#include "RandomEngine.h"
 
 namespace labyrinth { namespace model {
 
+struct GameState;
+
 /**
  * @brief Represents the maze of the game.
  */
 struct Maze
 {
 
-static constexpr unsigned SIZE = 7;
+static constexpr unsigned SIZE = MazeBitboard::SIZE;
+
+/**
+ * @brief Is the number of positions a maze card can be inserted at.
+ */
+static constexpr unsigned NB_OF_SLOTS = 4 * (SIZE / 2);
+
+/**
+ * @brief Is the cell of the objects set on the last pushed out card.
+ */
+static constexpr unsigned SPARE_CELL = MazeBitboard::CELLS;
+
+/**
+ * @brief Is the cell of the objects that are not set on any card.
+ */
+static constexpr unsigned NO_CELL = 0xFF;
 
 private:
 
@@ -25,43 +49,198 @@ private:
     MazeCard lastPushedOutMazeCard_;
 
     /**
-     * @brief is the previous position in this maze of the last maze card that
-     * has been pushed out.
+     * @brief is the previous cell in this maze of the last maze card that has
+     * been pushed out.
+     */
+    MazeCell lastPushedOutCell_;
+
+    /**
+     * @brief Represents the pathways of this maze cards. Every connectivity
+     * query is answered from it.
+     */
+    MazeBitboard pathways_;
+
+    /**
+     * @brief Are the cells of the line shifted by the last insertion.
      */
-    MazePosition lastPushedOutPosition_;
+    CellSet lastShiftedCells_;
 
     /**
-     * @brief Represents the adjacencies of this maze cards.
+     * @brief Are the cells whose card or links changed with the last insertion.
      */
-    std::map<MazePosition, std::vector<MazePosition>> adjacencies_;
+    CellSet lastChangedCells_;
+
+    /**
+     * @brief Is the Zobrist key of the cards inside of this maze. It is updated
+     * incrementally when cards are set or shifted.
+     */
+    std::uint64_t cardsKey_;
 
     /**
      * @brief are the cards inside of this maze.
      */
     MazeCard cards_[SIZE][SIZE];
 
-    void initializeCards();
+    /**
+     * @brief Are the cells of the objects, indexed by object. An object on the
+     * last pushed out card is at SPARE_CELL, an object on no card at NO_CELL.
+     */
+    std::uint8_t objectCells_[NONE];
+
+    /**
+     * @brief Sets the cards of this maze up. The movable cards are shuffled and
+     * rotated at random.
+     *
+     * @param engine is the random engine used to shuffle the cards.
+     */
+    void initializeCards(RandomEngine &engine);
+
+    /**
+     * @brief Builds the pathways of this maze from all of its cards.
+     *
+     * @return the pathways of this maze cards.
+     */
+    MazeBitboard buildPathways() const;
+
+    /**
+     * @brief Updates the pathways of the given cells only, and records the
+     * cells whose links changed in lastChangedCells_.
+     *
+     * @param cells are the cells whose card changed.
+     */
+    void updatePathwaysOf(const CellSet &cells);
+
+    /**
+     * @brief Gets the card of the given cell.
+     */
+    const MazeCard &getCardOf(MazeCell cell) const {
+        return cards_[cell.getRow()][cell.getColumn()];
+    }
+
+    /**
+     * @brief Gets the Zobrist key of the card of the given cell.
+     */
+    std::uint64_t getCardKeyOf(MazeCell cell) const;
+
+    /**
+     * @brief Computes the Zobrist key of all the cards inside of this maze.
+     */
+    std::uint64_t computeCardsKey() const;
+
+    /**
+     * @brief Xors the Zobrist keys of the cards of the given cells in or out of
+     * the key of this maze cards.
+     */
+    void toggleCardKeysOf(const CellSet &cells);
+
+    /**
+     * @brief Inserts the last pushed out card at the given position without
+     * checking that the position is inserrable.
+     *
+     * @param position is a position on a side of this maze.
+     * @return the maze card that has been pushed out.
+     */
+    MazeCard shiftLineFrom(const MazePosition &position);
+
+    /**
+     * @brief Records the cell of the object of the given card.
+     *
+     * @param card is the card whose object is recorded.
+     * @param cell is the cell of the card, or SPARE_CELL.
+     */
+    void setObjectCell(const MazeCard &card, unsigned cell) {
+        if (card.getObject() != NONE) {
+            objectCells_[card.getObject()] = static_cast<std::uint8_t>(cell);
+        }
+    }
+
+    /**
+     * @brief Records the cells of the objects of all the cards.
+     */
+    void indexObjects();
 
-    void initializeAdjacency();
+    /**
+     * @brief Requires the given position to be inside this maze.
+     *
+     * @param position is the position to check.
+     * @param message is the message of the exception thrown otherwise.
+     */
+    static void requireInside(const MazePosition &position, const char *message);
+
+    /**
+     * @brief Maze::insertUpSide insert a card on the maze's upper side. Only
+     * the cards move: the caches of this maze are kept up to date by
+     * shiftLineFrom, their only caller.
+     * @param ejected_card the ejected card
+     * @param position the position where to insert.
+     */
+    void insertUpSide(MazeCard &ejected_card, const MazePosition &position);
+
+    /**
+     * @brief Maze::insertDownSide insert a card on the maze's down side
+     * @param ejected_card the ejected card
+     * @param position the position where to insert.
+     */
+    void insertDownSide(MazeCard &ejected_card, const MazePosition &position);
+
+    /**
+     * @brief Maze::insertLeftSide insert a card on the maze's left side
+     * @param ejected_card the ejected card
+     * @param position the position where to insert.
+     */
+    void insertLeftSide(MazeCard &ejected_card, const MazePosition &position);
+
+    /**
+     * @brief Maze::insertRightSide insert a card on the maze's right side.
+     * @param ejected_card the ejected card
+     * @param position the position where to insert.
+     */
+    void insertRightSide(MazeCard &ejected_card, const MazePosition &position);
 
 public:
 
     /**
-     * @brief Constructs a maze of 7 by 7 maze cards. A maze contains:
+     * @brief Constructs a maze of SIZE by SIZE maze cards. A maze of 7 by 7
+     * contains:
      *    - 16 steady cards which are always at the same spot.
      *    - 34 movable cards which are randomly set on this maze.
      *
-     * 12 of the cards are marked with an objective.
+     * 24 of the cards are marked with an objective, whatever the size. The
+     * cards are shuffled with a newly seeded random engine.
+     */
+    Maze() {
+        RandomEngine engine{getRandomSeed()};
+        initialize(engine);
+    }
+
+    /**
+     * @brief Constructs a maze whose movable cards are shuffled and rotated
+     * with the given random engine.
+     *
+     * @param engine is the random engine used to shuffle the cards.
+     */
+    explicit Maze(RandomEngine &engine) { initialize(engine); }
+
+    /**
+     * @brief Constructs the maze of the given game state.
+     *
+     * @param state is the state to get the cards, the last pushed out card and
+     * the last insertion from.
      */
-    Maze() { initialize(); }
+    explicit Maze(const GameState &state);
+
+    Maze(const Maze &) = default;
 
     /**
      * @brief Initializes this maze. The cards are set up.
+     *
+     * @param engine is the random engine used to shuffle the cards.
      */
-    void initialize();
+    void initialize(RandomEngine &engine);
 
     /**
-     * @brief Updates the adjacency of this maze cards.
+     * @brief Updates the adjacency of this maze cards. The pathways of every
+     * card are rebuilt.
      */
     void updateAdjacency();
 
@@ -71,9 +250,7 @@ public:
      * @param position is the position of the card.
      * @param card is the card to set.
      */
-    void setCardAt(const MazePosition &position, const MazeCard &card) {
-        cards_[position.getRow()][position.getColumn()] = card;
-    }
+    void setCardAt(const MazePosition &position, const MazeCard &card);
 
     /**
      * @brief Gets the card located at the given position.
@@ -87,8 +264,81 @@ public:
 
     MazeCard &getLastPushedOutMazeCard() {return lastPushedOutMazeCard_;}
 
-    MazePosition getLastPushedOutMazePosition()const {return lastPushedOutPosition_;}
+    const MazeCard &getLastPushedOutMazeCard() const {return lastPushedOutMazeCard_;}
+
+    /**
+     * @brief Gets the cell of the card the given object is set on. The table
+     * is kept up to date by the insertions, so this is a single read.
+     *
+     * @param object is an object other than NONE.
+     * @return the cell of the object, SPARE_CELL if it is on the last pushed
+     * out card or NO_CELL if it is on no card.
+     */
+    unsigned getObjectCell(Object object) const { return objectCells_[object]; }
+
+    /**
+     * @brief Tells if the given object is on a card inside of this maze.
+     *
+     * @param object is an object other than NONE.
+     * @return true if the object is inside of this maze.
+     */
+    bool isInside(Object object) const { return objectCells_[object] < SPARE_CELL; }
+
+    /**
+     * @brief Gets the position of the card the given object is set on. The
+     * object should be inside of this maze.
+     *
+     * @param object is an object inside of this maze.
+     * @return the position of the object.
+     */
+    MazePosition getObjectPosition(Object object) const {
+        return MazeBitboard::getPosition(objectCells_[object]);
+    }
+
+    MazePosition getLastPushedOutMazePosition()const {return lastPushedOutCell_.getPosition();}
+
+    /**
+     * @brief Gets the Zobrist key of this maze. It covers the cards inside of
+     * this maze, the last pushed out card and the blocked position.
+     *
+     * Only the cards of the shifted line are rehashed by an insertion. The last
+     * pushed out card may be rotated through getLastPushedOutMazeCard, so its
+     * key is xored in when the key is asked for.
+     *
+     * @return the key of this maze.
+     */
+    std::uint64_t getKey() const;
+
+    /**
+     * @brief Gets the pathways of this maze as bitboards.
+     *
+     * @return the pathways of this maze.
+     */
+    const MazeBitboard &getPathways() const { return pathways_; }
+
+    /**
+     * @brief Gets the cells of the line (row or column) shifted by the last
+     * insertion.
+     *
+     * @return the shifted cells, empty if no insertion took place.
+     */
+    CellSet getLastShiftedCells() const { return lastShiftedCells_; }
 
+    /**
+     * @brief Gets the cells changed by the last insertion. A cell changed if
+     * its card changed or if one of its links to a neighbor appeared or
+     * disappeared.
+     *
+     * @return the changed cells, empty if no insertion took place.
+     */
+    CellSet getLastChangedCells() const { return lastChangedCells_; }
+
+    /**
+     * @brief Gets the positions linked by a direct path to the given one.
+     *
+     * @param pos is the position to get the neighbors of.
+     * @return the neighbors of the given position.
+     */
     std::vector<MazePosition> getNeighbors(const MazePosition &pos) const;
 
     /**
@@ -100,6 +350,15 @@ public:
      */
     bool existDirectPathBetween(const MazePosition &lhs, const MazePosition &rhs) const;
 
+    /**
+     * @brief Gets the positions that can be reached by a path from the given
+     * one. The whole region is computed by a single traversal.
+     *
+     * @param position is the position to start from.
+     * @return the reachable positions, the given one included.
+     */
+    CellSet reachableFrom(const MazePosition &position) const;
+
     /**
      * @brief Tells if the two position are linked by a path in this maze.
      *
@@ -109,6 +368,16 @@ public:
      */
     bool existPathBetween(const MazePosition &lhs, const MazePosition &rhs) const;
 
+    /**
+     * @brief Fills the given field with the length of the shortest walk from
+     * the given position to every cell of this maze, in a single traversal.
+     *
+     * @param position is the position to start from.
+     * @param field is the field to fill, unreachable cells being marked as
+     * DistanceField::UNREACHABLE.
+     */
+    void computeDistancesFrom(const MazePosition &position, DistanceField &field) const;
+
     /**
      * @brief Tells if the given positions are adjacent.
      *
@@ -128,11 +397,30 @@ public:
      * than the position of last pushed out card and must be on a side of this
      * maze.
      *
+     * Only the pathways of the shifted line are updated. The shifted and
+     * changed cells are then given by getLastShiftedCells and
+     * getLastChangedCells.
+     *
      * @param position is the position of the maze card to insert.
      * @return the maze card that has been pushed out.
      */
     MazeCard insertLastPushedOutMazeCardAt(const MazePosition &position);
 
+    /**
+     * @brief Undoes the last insertion. The inserted card is pushed back out
+     * and the pushed out card gets back to its former position, then the
+     * blocked position and the cells of the insertion before are restored.
+     *
+     * @param position is the position the last insertion took place at.
+     * @param blockedPosition is the last pushed out position before the last
+     * insertion.
+     * @param shiftedCells are the last shifted cells before the last insertion.
+     * @param changedCells are the last changed cells before the last insertion.
+     */
+    void undoInsertionAt(const MazePosition &position,
+                         const MazePosition &blockedPosition,
+                         const CellSet &shiftedCells, const CellSet &changedCells);
+
     /**
      * @brief Tells if the given position is out og this maze bounds.
      *
@@ -158,35 +446,37 @@ public:
      */
     bool isOnASide(const MazePosition &position) const;
 
-    /**
-     * @brief Maze::insertUpSide insert a card on the maze's upper side
-     * @param ejected_card the ejected card
-     * @param position the position where to insert.
-     */
-    void insertUpSide(MazeCard &ejected_card, const MazePosition &position);
+    MazePosition getOpposite(const MazePosition &pos) const;
 
     /**
-     * @brief Maze::insertDownSide insert a card on the maze's down side
-     * @param ejected_card the ejected card
-     * @param position the position where to insert.
+     * @brief Gets the positions a maze card can be inserted at, whether they
+     * are blocked by the last push out position or not.
+     *
+     * @return the insertion slots of a maze, side by side.
      */
-    void insertDownSide(MazeCard &ejected_card, const MazePosition &position);
+    static const std::array<MazePosition, NB_OF_SLOTS> &getInsertionSlots();
 
     /**
-     * @brief Maze::insertLeftSide insert a card on the maze's left side
-     * @param ejected_card the ejected card
-     * @param position the position where to insert.
+     * @brief Gets the position a piece standing at the given position ends up
+     * at when a maze card is inserted at the given slot. A piece pushed out of
+     * this maze is moved to the inserted card.
+     *
+     * @param position is the position of the piece.
+     * @param slot is the position of the inserted card.
+     * @return the position of the piece after the insertion.
      */
-    void insertLeftSide(MazeCard &ejected_card, const MazePosition &position);
+    MazePosition getShiftedPosition(const MazePosition &position,
+                                    const MazePosition &slot) const;
 
     /**
-     * @brief Maze::insertRightSide insert a card on the maze's right side.
-     * @param ejected_card the ejected card
-     * @param position the position where to insert.
+     * @brief Tells if the given position is inserrable. An inserrable position
+     * is on a side, holds a movable card and is different from the last push
+     * out position.
+     *
+     * @param position is the position to check.
+     * @return true if the last pushed out card can be inserted at the position.
      */
-    void insertRightSide(MazeCard &ejected_card, const MazePosition &position);
-
-    MazePosition getOpposite(const MazePosition &pos);
+    bool isInserrable(const MazePosition &position) const;
 
     /**
      * @brief Requires a inserrable position. An inserrable position is on a side
@@ -195,7 +485,7 @@ public:
      */
     void requireInserrable(const MazePosition &position) const;
 
-    Maze& operator =(const Maze& that);
+    Maze &operator=(const Maze &) = default;
 
 };
 
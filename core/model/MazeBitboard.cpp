@@ -0,0 +1,114 @@
+#include "MazeBitboard.h"
+
+namespace labyrinth { namespace model {
+
+constexpr unsigned MazeBitboard::SIZE;
+constexpr unsigned MazeBitboard::CELLS;
+constexpr Bitboard MazeBitboard::ALL;
+
+static constexpr Bitboard getColumnMask(unsigned column)
+{
+    Bitboard mask = 0;
+    for (unsigned row = 0; row < MazeBitboard::SIZE; ++row) {
+        mask |= Bitboard{1} << (row * MazeBitboard::SIZE + column);
+    }
+    return mask;
+}
+
+/**
+ * @brief Are the cells whose right neighbor is on the same row.
+ */
+static constexpr Bitboard HAS_RIGHT_NEIGHBOR =
+        MazeBitboard::ALL & ~getColumnMask(MazeBitboard::SIZE - 1);
+
+MazeBitboard::MazeBitboard()
+    : openings_{0, 0, 0, 0},
+      shapes_{}
+{}
+
+unsigned MazeBitboard::getDirectionIndex(MazeDirection direction)
+{
+    switch (direction)
+    {
+    case UP:
+        return 0;
+    case RIGHT:
+        return 1;
+    case DOWN:
+        return 2;
+    case LEFT:
+        return 3;
+    }
+    return 0;
+}
+
+void MazeBitboard::setShape(unsigned cell, unsigned shape)
+{
+    unsigned offset = cell % 16 * 4;
+    shapes_[cell / 16] &= ~(std::uint64_t{0xF} << offset);
+    shapes_[cell / 16] |= std::uint64_t{shape & 0xF} << offset;
+    for (MazeDirection dir = UP; dir <= LEFT; ++dir) {
+        Bitboard &openings = openings_[getDirectionIndex(dir)];
+        if (shape & dir) {
+            openings |= getBit(cell);
+        } else {
+            openings &= ~getBit(cell);
+        }
+    }
+}
+
+Bitboard MazeBitboard::getLinks(MazeDirection direction) const
+{
+    Bitboard right = openings_[1] & (openings_[3] >> 1) & HAS_RIGHT_NEIGHBOR;
+    Bitboard down = openings_[2] & (openings_[0] >> SIZE);
+    switch (direction)
+    {
+    case UP:
+        return down << SIZE;
+    case RIGHT:
+        return right;
+    case DOWN:
+        return down;
+    case LEFT:
+        return right << 1;
+    }
+    return 0;
+}
+
+Bitboard MazeBitboard::getNeighbors(unsigned cell) const
+{
+    Bitboard neighbors = 0;
+    Bitboard bit = getBit(cell);
+    neighbors |= (getLinks(UP) & bit) >> SIZE;
+    neighbors |= (getLinks(RIGHT) & bit) << 1;
+    neighbors |= (getLinks(DOWN) & bit) << SIZE;
+    neighbors |= (getLinks(LEFT) & bit) >> 1;
+    return neighbors;
+}
+
+Bitboard MazeBitboard::getReachable(Bitboard from) const
+{
+    Bitboard right = getLinks(RIGHT);
+    Bitboard down = getLinks(DOWN);
+    Bitboard reached = from & ALL;
+    Bitboard previous;
+    do {
+        previous = reached;
+        reached |= ((reached & right) << 1) | ((reached >> 1) & right)
+                | ((reached & down) << SIZE) | ((reached >> SIZE) & down);
+    } while (reached != previous);
+    return reached;
+}
+
+bool MazeBitboard::operator==(const MazeBitboard &other) const
+{
+    for (unsigned i = 0; i < 4; ++i) {
+        if (openings_[i] != other.openings_[i]) return false;
+    }
+    for (unsigned i = 0; i < (CELLS + 15) / 16; ++i) {
+        if (shapes_[i] != other.shapes_[i]) return false;
+    }
+    return true;
+}
+
+}}
@@ -0,0 +1,276 @@
+#ifndef MAZEBITBOARD_H
+#define MAZEBITBOARD_H
+
+#include <cstdint>
+
+#include "MazeDirection.h"
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+#ifndef LABYRINTH_MAZE_SIZE
+/**
+ * @brief Is the number of rows (and columns) of the maze. It is chosen when
+ * building, with the MAZE_SIZE variable of qmake (see defaults.pri), so that
+ * every array and loop over the cells has a size known to the compiler.
+ */
+#define LABYRINTH_MAZE_SIZE 7
+#endif
+
+/**
+ * @brief Gives the unsigned integer holding one bit per cell of a maze of the
+ * given number of cells: 64 bits up to a maze of 7 by 7, 128 bits beyond.
+ */
+template <unsigned NB_OF_CELLS, bool IS_WIDE = (NB_OF_CELLS >= 64)>
+struct BitboardOf
+{
+    typedef std::uint64_t type;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <unsigned NB_OF_CELLS>
+struct BitboardOf<NB_OF_CELLS, true>
+{
+    typedef unsigned __int128 type;
+};
+#endif
+
+/**
+ * @brief Represents a set of cells of the maze, one bit per cell. The cell at
+ * (row; column) is the bit row * MazeBitboard::SIZE + column.
+ */
+typedef BitboardOf<LABYRINTH_MAZE_SIZE * LABYRINTH_MAZE_SIZE>::type Bitboard;
+
+/**
+ * @brief Gets the lowest cell of the given bitboard.
+ *
+ * @param cells is a bitboard containing at least one cell.
+ * @return the index of the lowest cell of the bitboard.
+ */
+inline unsigned getLowestCell(std::uint64_t cells) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(cells));
+#else
+    unsigned cell = 0;
+    while (!((cells >> cell) & 1)) ++cell;
+    return cell;
+#endif
+}
+
+/**
+ * @brief Counts the cells of the given bitboard.
+ *
+ * @param cells is the bitboard to count the cells of.
+ * @return the number of cells in the bitboard.
+ */
+inline unsigned countCells(std::uint64_t cells) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(cells));
+#else
+    unsigned count = 0;
+    for (; cells; cells &= cells - 1) ++count;
+    return count;
+#endif
+}
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @brief Gets the lowest cell of the given wide bitboard.
+ *
+ * @param cells is a bitboard containing at least one cell.
+ * @return the index of the lowest cell of the bitboard.
+ */
+inline unsigned getLowestCell(unsigned __int128 cells) {
+    std::uint64_t low = static_cast<std::uint64_t>(cells);
+    return low ? getLowestCell(low)
+               : 64 + getLowestCell(static_cast<std::uint64_t>(cells >> 64));
+}
+
+/**
+ * @brief Counts the cells of the given wide bitboard.
+ *
+ * @param cells is the bitboard to count the cells of.
+ * @return the number of cells in the bitboard.
+ */
+inline unsigned countCells(unsigned __int128 cells) {
+    return countCells(static_cast<std::uint64_t>(cells))
+            + countCells(static_cast<std::uint64_t>(cells >> 64));
+}
+#endif
+
+/**
+ * @brief Represents the pathways of a maze as bitboards.
+ *
+ * For each direction, one bitboard tells which cells are opened in that
+ * direction. The shapes of the cells are also kept packed on 4 bits. Every
+ * connectivity query of the maze is answered with shifts and masks over these
+ * bitboards.
+ */
+class MazeBitboard
+{
+
+public:
+
+    /**
+     * @brief Is the number of rows (and columns) of the represented maze.
+     */
+    static constexpr unsigned SIZE = LABYRINTH_MAZE_SIZE;
+
+    /**
+     * @brief Is the number of cells of the represented maze.
+     */
+    static constexpr unsigned CELLS = SIZE * SIZE;
+
+    /**
+     * @brief Is the bitboard containing every cell of the maze.
+     */
+    static constexpr Bitboard ALL = (Bitboard{1} << CELLS) - 1;
+
+    static_assert(SIZE % 2 == 1 && SIZE >= 7,
+                  "The maze has steady cards on its corners and room for every object.");
+
+    static_assert(CELLS < 8 * sizeof(Bitboard),
+                  "A bitboard should have one bit per cell of the maze.");
+
+private:
+
+    /**
+     * @brief Are the cells opened in each direction, indexed by
+     * getDirectionIndex.
+     */
+    Bitboard openings_[4];
+
+    /**
+     * @brief Are the shapes of the cells, 16 shapes of 4 bits per word.
+     */
+    std::uint64_t shapes_[(CELLS + 15) / 16];
+
+public:
+
+    /**
+     * @brief Constructs a bitboard in which no cell is opened.
+     */
+    MazeBitboard();
+
+    /**
+     * @brief Gets the index of the bitboard of the given direction.
+     *
+     * @param direction is the direction to get the index of.
+     * @return 0 for up, 1 for right, 2 for down and 3 for left.
+     */
+    static unsigned getDirectionIndex(MazeDirection direction);
+
+    /**
+     * @brief Tells if the given position lies inside the maze.
+     *
+     * @param position is the position to check.
+     * @return true if the position has a cell in the maze.
+     */
+    static bool isInside(const MazePosition &position) {
+        return position.getRow() < SIZE && position.getColumn() < SIZE;
+    }
+
+    /**
+     * @brief Gets the cell index of the given position. The position should be
+     * inside the maze.
+     *
+     * @param position is the position to get the index of.
+     * @return the index of the cell.
+     */
+    static unsigned getCell(const MazePosition &position) {
+        return position.getRow() * SIZE + position.getColumn();
+    }
+
+    /**
+     * @brief Gets the position of the given cell index.
+     *
+     * @param cell is an index between 0 and CELLS - 1.
+     * @return the position of the cell.
+     */
+    static MazePosition getPosition(unsigned cell) {
+        return MazePosition{cell / SIZE, cell % SIZE, MazePosition::Unchecked{}};
+    }
+
+    /**
+     * @brief Gets the bitboard only containing the given cell.
+     *
+     * @param cell is an index between 0 and CELLS - 1.
+     * @return the bitboard of the cell.
+     */
+    static Bitboard getBit(unsigned cell) { return Bitboard{1} << cell; }
+
+    /**
+     * @brief Sets the shape of the given cell.
+     *
+     * @param cell is the index of the cell.
+     * @param shape is the value of a maze card shape (see MazeDirection).
+     */
+    void setShape(unsigned cell, unsigned shape);
+
+    /**
+     * @brief Gets the shape of the given cell.
+     *
+     * @param cell is the index of the cell.
+     * @return the value of the maze card shape of the cell.
+     */
+    unsigned getShape(unsigned cell) const {
+        return (shapes_[cell / 16] >> (cell % 16 * 4)) & 0xF;
+    }
+
+    /**
+     * @brief Gets the cells opened in the given direction.
+     *
+     * @param direction is the direction of the openings.
+     * @return the cells that are opened in the given direction.
+     */
+    Bitboard getOpenings(MazeDirection direction) const {
+        return openings_[getDirectionIndex(direction)];
+    }
+
+    /**
+     * @brief Gets the cells that are linked by a path to their neighbor in the
+     * given direction.
+     *
+     * @param direction is the direction of the neighbor.
+     * @return the cells linked to their neighbor in the given direction.
+     */
+    Bitboard getLinks(MazeDirection direction) const;
+
+    /**
+     * @brief Gets the neighbors of the given cell that are linked to it by a
+     * path.
+     *
+     * @param cell is the index of the cell.
+     * @return the linked neighbors of the cell.
+     */
+    Bitboard getNeighbors(unsigned cell) const;
+
+    /**
+     * @brief Tells if the given cell is linked to its neighbor in the given
+     * direction.
+     *
+     * @param cell is the index of the cell.
+     * @param direction is the direction of the neighbor.
+     * @return true if the cell and its neighbor are linked by a path.
+     */
+    bool isLinked(unsigned cell, MazeDirection direction) const {
+        return (getLinks(direction) >> cell) & 1;
+    }
+
+    /**
+     * @brief Gets the cells that can be reached by a path from the given cells.
+     *
+     * @param from are the cells to start from.
+     * @return the cells reachable from the given ones, themselves included.
+     */
+    Bitboard getReachable(Bitboard from) const;
+
+    bool operator==(const MazeBitboard &other) const;
+
+    bool operator!=(const MazeBitboard &other) const { return !(*this == other); }
+
+};
+
+}}
+
+#endif // MAZEBITBOARD_H
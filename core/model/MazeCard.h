@@ -84,7 +84,7 @@ public:
      * @brief getShape Gets the shape of the MazeCard.
      * @return the shape of the MazeCard.
      */
-    MazeCardShape getShape(){return shape_;}
+    MazeCardShape getShape() const {return shape_;}
 
     /**
      * @brief Tells if this card is a T.
@@ -126,6 +126,25 @@ public:
                                             " because she isn't movable");
     }
 
+    /**
+     * @brief Rotates this maze card the given number of quarter turns.
+     *
+     * @param times is the number of quarter turns.
+     */
+    void rotate(unsigned times) {
+        isMovable_ ? shape_.rotate(times) :
+                     throw std::logic_error("The card couldn't be rotated"
+                                            " because she isn't movable");
+    }
+
+    /**
+     * @brief Gets the number of distinct orientations of this maze card (see
+     * MazeCardShape::getNbOfOrientations).
+     *
+     * @return 2 for an I card, 4 for a L or a T card.
+     */
+    unsigned getNbOfOrientations() const { return shape_.getNbOfOrientations(); }
+
     /**
      * @brief hasSameType tells if the current mazeCard has the same type than
      * the other.
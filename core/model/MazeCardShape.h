@@ -1,10 +1,74 @@
 #ifndef MAZECARDSHAPE_H
 #define MAZECARDSHAPE_H
 
+#include <cstdint>
+
 #include "MazeDirection.h"
 
 namespace labyrinth { namespace model {
 
+/**
+ * @brief Are the properties of the 16 values of a maze card shape, computed by
+ * the compiler so that every query on a shape is a single read.
+ */
+struct MazeCardShapeTable
+{
+
+    /**
+     * @brief Are the values of each shape once rotated 0 to 3 quarter turns.
+     */
+    std::uint8_t rotations[16][4];
+
+    /**
+     * @brief Are the kinds of the shapes (see MazeCardShape::Kind).
+     */
+    std::uint8_t kinds[16];
+
+    /**
+     * @brief Are the smallest values among the rotations of each shape.
+     */
+    std::uint8_t canonicals[16];
+
+    /**
+     * @brief Are the numbers of quarter turns from the canonical value to each
+     * shape.
+     */
+    std::uint8_t orientations[16];
+
+    /**
+     * @brief Are the numbers of distinct rotations of each shape: 1, 2 or 4.
+     */
+    std::uint8_t nbOfOrientations[16];
+
+    constexpr MazeCardShapeTable();
+
+};
+
+constexpr MazeCardShapeTable::MazeCardShapeTable()
+    : rotations{}, kinds{}, canonicals{}, orientations{}, nbOfOrientations{}
+{
+    for (unsigned value = 0; value < 16; ++value) {
+        unsigned rotated = value;
+        for (unsigned turns = 0; turns < 4; ++turns) {
+            rotations[value][turns] = static_cast<std::uint8_t>(rotated);
+            rotated = ((rotated << 1) | (rotated >> 3)) & 0xF;
+        }
+        unsigned count = (value & 1) + (value >> 1 & 1) + (value >> 2 & 1) + (value >> 3 & 1);
+        bool isStraight = value == (UP | DOWN) || value == (LEFT | RIGHT);
+        kinds[value] = static_cast<std::uint8_t>(count == 2 ? (isStraight ? 2 : 3)
+                                                 : count < 2 ? count : count + 1);
+        unsigned canonical = 0;
+        for (unsigned turns = 1; turns < 4; ++turns) {
+            if (rotations[value][turns] < rotations[value][canonical]) canonical = turns;
+        }
+        unsigned period = 1;
+        while (period < 4 && rotations[value][period] != value) ++period;
+        canonicals[value] = rotations[value][canonical];
+        orientations[value] = static_cast<std::uint8_t>((4 - canonical) % period);
+        nbOfOrientations[value] = static_cast<std::uint8_t>(period);
+    }
+}
+
 /**
  * @brief @brief Represents the shape of a maze card.
  *
@@ -19,6 +83,24 @@ public:
     static const unsigned MAX_VALUE{0b1110};
     static const unsigned MIN_VALUE{0b0001};
 
+    /**
+     * @brief Are the kinds of shapes, whatever their rotation.
+     */
+    enum class Kind
+    {
+        NONE,
+        DEAD_END,
+        I,
+        L,
+        T,
+        CROSS
+    };
+
+    /**
+     * @brief Are the properties of every shape value.
+     */
+    static constexpr MazeCardShapeTable TABLE{};
+
     /**
      * @brief Constructs this maze card shape.
      *
@@ -37,7 +119,7 @@ public:
      * @brief getValue gets the shape of the MazeCardShape.
      * @return the shape.
      */
-    MazeDirection getValue(){return value_;}
+    MazeDirection getValue() const {return value_;}
 
     /**
      * @brief Tells if this maze card shape is going to the given direction.
@@ -49,31 +131,74 @@ public:
         return value_ & direction;
     }
 
+    /**
+     * @brief Gets the kind of this shape.
+     *
+     * @return the kind of this shape, whatever its rotation.
+     */
+    Kind getKind() const { return static_cast<Kind>(TABLE.kinds[value_]); }
+
     /**
      * @brief Tells if this card is a L.
      *
      * @return true if this card is a L.
      */
-    bool isL() const;
+    bool isL() const { return getKind() == Kind::L; }
 
     /**
      * @brief Tells if this card is a T.
      *
      * @return true if this card is a T.
      */
-    bool isT() const;
+    bool isT() const { return getKind() == Kind::T; }
 
     /**
      * @brief Tells if this card is an I.
      *
      * @return true if this card is an I.
      */
-    bool isI() const;
+    bool isI() const { return getKind() == Kind::I; }
+
+    /**
+     * @brief Rotates this maze card shape a quarter turn clockwise.
+     */
+    void rotate() { rotate(1); }
+
+    /**
+     * @brief Rotates this maze card shape the given number of quarter turns
+     * clockwise.
+     *
+     * @param times is the number of quarter turns.
+     */
+    void rotate(unsigned times) {
+        value_ = static_cast<MazeDirection>(TABLE.rotations[value_][times % 4]);
+    }
 
     /**
-     * @brief Rotates this maze card shape.
+     * @brief Gets the number of distinct rotations of this shape: 2 for an I,
+     * 4 for a L or a T. Rotating the shape from 0 to this number minus one
+     * quarter turns gives every distinct orientation exactly once.
+     *
+     * @return the number of distinct orientations of this shape.
+     */
+    unsigned getNbOfOrientations() const { return TABLE.nbOfOrientations[value_]; }
+
+    /**
+     * @brief Gets the smallest value among the rotations of this shape. Two
+     * shapes are rotations of one another if they have the same canonical
+     * value.
+     *
+     * @return the canonical value of this shape.
+     */
+    unsigned getCanonicalValue() const { return TABLE.canonicals[value_]; }
+
+    /**
+     * @brief Gets the number of quarter turns from the canonical value to this
+     * shape.
+     *
+     * @return the orientation of this shape, lower than getNbOfOrientations.
      */
-    void rotate();
+    unsigned getOrientation() const { return TABLE.orientations[value_]; }
 
     bool operator==(const MazeCardShape &other) const;
 
@@ -1,35 +1,73 @@
 #include "MazeCardsBuilder.h"
+#include "MazeBitboard.h"
 
 #include <iostream>
 
 namespace labyrinth { namespace model {
 
-Object MazeCardsBuilder::CURRENT_OBJECT = Object::GHOST;
+/**
+ * @brief Is the number of steady cards: one per cell of an even row and an
+ * even column.
+ */
+static constexpr unsigned NB_OF_STEADY_CARDS =
+        (MazeBitboard::SIZE + 1) / 2 * ((MazeBitboard::SIZE + 1) / 2);
+
+/**
+ * @brief Is the number of movable cards without an object: one per cell
+ * without a steady card, plus the one left out of the maze, but the 12 marked
+ * ones.
+ */
+static constexpr unsigned NB_OF_PLAIN_CARDS =
+        MazeBitboard::CELLS - NB_OF_STEADY_CARDS + 1 - 12;
+
 unsigned MazeCardsBuilder::MARKED_T_CARDS = 6;
-unsigned MazeCardsBuilder::I_CARDS = 12;
-unsigned MazeCardsBuilder::L_CARDS = 10;
+unsigned MazeCardsBuilder::I_CARDS = NB_OF_PLAIN_CARDS / 2 + 1;
+unsigned MazeCardsBuilder::L_CARDS = (NB_OF_PLAIN_CARDS - 1) / 2;
 unsigned MazeCardsBuilder::MARKED_L_CARDS = 6;
 
+/**
+ * @brief Are the objects of the steady cards, set in reading order on the
+ * steady cards that are not in a corner of the maze.
+ */
+static const Object STEADY_OBJECTS[] = {
+    GRIMOIRE, PURSE_OF_GOLD, MAP, CROWN, KEYS, BONES,
+    RING, TREASURE_CHEST, EMERALD, SWORD, CHANDELIER, HELMET
+};
 
+/**
+ * @brief Gets the shape of the steady card at the given position. The cards
+ * on a side are closed toward the outside, the ones inside the maze are
+ * closed in a different direction in each quarter of the maze.
+ */
+static unsigned getSteadyShape(unsigned row, unsigned column)
+{
+    const unsigned last = MazeBitboard::SIZE - 1;
+    unsigned shape = UP | RIGHT | DOWN | LEFT;
+    if (row == 0) shape &= ~UP;
+    if (column == last) shape &= ~RIGHT;
+    if (row == last) shape &= ~DOWN;
+    if (column == 0) shape &= ~LEFT;
+    if (shape == (UP | RIGHT | DOWN | LEFT)) {
+        bool isTop = 2 * row < last;
+        bool isLeft = 2 * column < last;
+        if (isTop) shape &= isLeft ? ~LEFT : ~UP;
+        else shape &= isLeft ? ~DOWN : ~RIGHT;
+    }
+    return shape;
+}
 
 void MazeCardsBuilder::getSteadyCards(std::vector<MazeCard> &steadyCards)
 {
-    steadyCards.push_back(MazeCard{RIGHT | DOWN, false});
-    steadyCards.push_back(MazeCard{RIGHT | DOWN | LEFT, false, GRIMOIRE});
-    steadyCards.push_back(MazeCard{RIGHT | DOWN | LEFT, false, PURSE_OF_GOLD});
-    steadyCards.push_back(MazeCard{LEFT | DOWN, false});
-    steadyCards.push_back(MazeCard{UP | DOWN | RIGHT, false, MAP});
-    steadyCards.push_back(MazeCard{UP | DOWN | RIGHT, false, CROWN});
-    steadyCards.push_back(MazeCard{LEFT | DOWN | RIGHT, false, KEYS});
-    steadyCards.push_back(MazeCard{LEFT | UP | DOWN, false, BONES});
-    steadyCards.push_back(MazeCard{UP | DOWN | RIGHT, false, RING});
-    steadyCards.push_back(MazeCard{LEFT | UP | RIGHT, false, TREASURE_CHEST});
-    steadyCards.push_back(MazeCard{LEFT | DOWN | UP, false, EMERALD});
-    steadyCards.push_back(MazeCard{LEFT | DOWN | UP, false, SWORD});
-    steadyCards.push_back(MazeCard{RIGHT | UP, false});
-    steadyCards.push_back(MazeCard{RIGHT | LEFT | UP, false, CHANDELIER});
-    steadyCards.push_back(MazeCard{RIGHT | LEFT | UP, false, HELMET});
-    steadyCards.push_back(MazeCard{LEFT | UP, false});
+    const unsigned last = MazeBitboard::SIZE - 1;
+    unsigned object = 0;
+    for (unsigned row = 0; row <= last; row += 2) {
+        for (unsigned column = 0; column <= last; column += 2) {
+            bool isCorner = (row == 0 || row == last) && (column == 0 || column == last);
+            bool isMarked = !isCorner && object < sizeof(STEADY_OBJECTS) / sizeof(Object);
+            steadyCards.push_back(MazeCard{getSteadyShape(row, column), false,
+                                           isMarked ? STEADY_OBJECTS[object++] : NONE});
+        }
+    }
 }
 
 void MazeCardsBuilder::constructICards(std::vector<MazeCard> &cards) {
@@ -46,15 +84,15 @@ void MazeCardsBuilder::constructLCards(std::vector<MazeCard> &cards) {
 
 void MazeCardsBuilder::constructMarkedTCards(std::vector<MazeCard> &cards) {
     for (unsigned i = 0; i < MARKED_T_CARDS; ++i) {
-        cards.push_back(MazeCard{UP | DOWN | RIGHT, true, CURRENT_OBJECT});
-        ++CURRENT_OBJECT;
+        Object object = static_cast<Object>(MARKED_L_CARDS + i);
+        cards.push_back(MazeCard{UP | DOWN | RIGHT, true, object});
     }
 }
 
 void MazeCardsBuilder::constructMarkedLCards(std::vector<MazeCard> &cards) {
     for (unsigned i = 0; i < MARKED_L_CARDS; ++i) {
-        cards.push_back(MazeCard{UP | RIGHT, true, CURRENT_OBJECT});
-        ++CURRENT_OBJECT;
+        Object object = static_cast<Object>(i);
+        cards.push_back(MazeCard{UP | RIGHT, true, object});
     }
 }
 
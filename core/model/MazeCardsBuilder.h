@@ -22,7 +22,8 @@ struct MazeCardsBuilder
     MazeCardsBuilder() = default;
 
     /**
-     * @brief Gets all the steady cards.
+     * @brief Gets all the steady cards, in the reading order of their
+     * positions in the maze.
      *
      * @param cards is the vector containing the cards.
      */
@@ -43,10 +44,6 @@ struct MazeCardsBuilder
 
     static void constructMarkedLCards(std::vector<MazeCard> &cards);
 
-private:
-
-    static Object CURRENT_OBJECT;
-
 };
 
 }}
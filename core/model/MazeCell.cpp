@@ -0,0 +1,19 @@
+#include "MazeCell.h"
+
+#include <stdexcept>
+
+namespace labyrinth { namespace model {
+
+constexpr std::uint8_t MazeCellTable::NO_NEIGHBOR;
+
+constexpr MazeCellTable MazeCell::TABLE;
+
+MazeCell MazeCell::of(const MazePosition &position)
+{
+    if (!MazeBitboard::isInside(position)) {
+        throw std::invalid_argument("The position is outside of the maze.");
+    }
+    return MazeCell{MazeBitboard::getCell(position)};
+}
+
+}}
@@ -0,0 +1,198 @@
+#ifndef MAZECELL_H
+#define MAZECELL_H
+
+#include <cstdint>
+
+#include "MazeBitboard.h"
+#include "MazeDirection.h"
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Are the coordinates and the neighbors of the cells of the maze,
+ * computed by the compiler so that moving from a cell to another is a single
+ * read.
+ */
+struct MazeCellTable
+{
+
+    /**
+     * @brief Is the neighbor of the cells on the side of the maze.
+     */
+    static constexpr std::uint8_t NO_NEIGHBOR = 0xFF;
+
+    /**
+     * @brief Are the rows of the cells.
+     */
+    std::uint8_t rows[MazeBitboard::CELLS];
+
+    /**
+     * @brief Are the columns of the cells.
+     */
+    std::uint8_t columns[MazeBitboard::CELLS];
+
+    /**
+     * @brief Are the neighbors of the cells up, right, down and left of them,
+     * NO_NEIGHBOR outside of the maze.
+     */
+    std::uint8_t neighbors[MazeBitboard::CELLS][4];
+
+    constexpr MazeCellTable();
+
+    /**
+     * @brief Gets the index of the given direction in the neighbors of a cell.
+     *
+     * @param direction is one of the 4 directions.
+     * @return 0 for UP, 1 for RIGHT, 2 for DOWN and 3 for LEFT.
+     */
+    static constexpr unsigned getIndexOf(MazeDirection direction) {
+        return direction == UP ? 0 : direction == RIGHT ? 1 : direction == DOWN ? 2 : 3;
+    }
+
+};
+
+constexpr MazeCellTable::MazeCellTable()
+    : rows{}, columns{}, neighbors{}
+{
+    const unsigned size = MazeBitboard::SIZE;
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        unsigned row = cell / size;
+        unsigned column = cell % size;
+        rows[cell] = static_cast<std::uint8_t>(row);
+        columns[cell] = static_cast<std::uint8_t>(column);
+        neighbors[cell][0] = row > 0 ? static_cast<std::uint8_t>(cell - size) : NO_NEIGHBOR;
+        neighbors[cell][1] = column < size - 1 ? static_cast<std::uint8_t>(cell + 1) : NO_NEIGHBOR;
+        neighbors[cell][2] = row < size - 1 ? static_cast<std::uint8_t>(cell + size) : NO_NEIGHBOR;
+        neighbors[cell][3] = column > 0 ? static_cast<std::uint8_t>(cell - 1) : NO_NEIGHBOR;
+    }
+}
+
+/**
+ * @brief Represents a cell of the maze by its index on a single byte, the cell
+ * at (row; column) being row * MazeBitboard::SIZE + column.
+ *
+ * A cell is meant for the engine code, which only handles cells inside of the
+ * maze: it is constructed from its index without any check, and compared as a
+ * single byte. MazePosition stays the type of the positions given by the
+ * users of the model, and MazeCell::of checks them once at the boundary.
+ */
+class MazeCell
+{
+
+    /**
+     * @brief Is the index of this cell.
+     */
+    std::uint8_t index_;
+
+public:
+
+    /**
+     * @brief Are the coordinates and the neighbors of every cell.
+     */
+    static constexpr MazeCellTable TABLE{};
+
+    /**
+     * @brief Constructs the cell at the top left corner of the maze.
+     */
+    constexpr MazeCell()
+        : index_{0}
+    {}
+
+    /**
+     * @brief Constructs the cell of the given index, without checking it.
+     *
+     * @param index is an index between 0 and MazeBitboard::CELLS - 1.
+     */
+    explicit constexpr MazeCell(unsigned index)
+        : index_{static_cast<std::uint8_t>(index)}
+    {}
+
+    /**
+     * @brief Gets the cell of the given position.
+     *
+     * @param position is the position to get the cell of.
+     * @return the cell of the position.
+     * @throws std::invalid_argument if the position is outside of the maze.
+     */
+    static MazeCell of(const MazePosition &position);
+
+    /**
+     * @brief Gets the index of this cell.
+     *
+     * @return the index of this cell, between 0 and MazeBitboard::CELLS - 1.
+     */
+    constexpr unsigned getIndex() const { return index_; }
+
+    /**
+     * @brief Gets the row of this cell.
+     *
+     * @return the row of this cell.
+     */
+    unsigned getRow() const { return TABLE.rows[index_]; }
+
+    /**
+     * @brief Gets the column of this cell.
+     *
+     * @return the column of this cell.
+     */
+    unsigned getColumn() const { return TABLE.columns[index_]; }
+
+    /**
+     * @brief Gets the position of this cell.
+     *
+     * @return the position of this cell.
+     */
+    MazePosition getPosition() const {
+        return MazePosition{getRow(), getColumn(), MazePosition::Unchecked{}};
+    }
+
+    /**
+     * @brief Gets the bitboard only containing this cell.
+     *
+     * @return the bitboard of this cell.
+     */
+    Bitboard getBit() const { return MazeBitboard::getBit(index_); }
+
+    /**
+     * @brief Tells if this cell has a neighbor in the given direction.
+     *
+     * @param direction is the direction to look at.
+     * @return true if this cell is not on the side of the maze in the given
+     * direction.
+     */
+    bool hasNeighbor(MazeDirection direction) const {
+        return TABLE.neighbors[index_][MazeCellTable::getIndexOf(direction)]
+                != MazeCellTable::NO_NEIGHBOR;
+    }
+
+    /**
+     * @brief Gets the neighbor of this cell in the given direction. This cell
+     * should have a neighbor in that direction.
+     *
+     * @param direction is the direction of the neighbor.
+     * @return the neighbor of this cell.
+     */
+    MazeCell getNeighbor(MazeDirection direction) const {
+        return MazeCell{TABLE.neighbors[index_][MazeCellTable::getIndexOf(direction)]};
+    }
+
+};
+
+static_assert(sizeof(MazeCell) == 1, "A cell should be packed on a single byte.");
+
+inline bool operator==(MazeCell lhs, MazeCell rhs) {
+    return lhs.getIndex() == rhs.getIndex();
+}
+
+inline bool operator!=(MazeCell lhs, MazeCell rhs) {
+    return lhs.getIndex() != rhs.getIndex();
+}
+
+inline bool operator<(MazeCell lhs, MazeCell rhs) {
+    return lhs.getIndex() < rhs.getIndex();
+}
+
+}}
+
+#endif // MAZECELL_H
@@ -5,8 +5,11 @@ namespace labyrinth { namespace model {
 
 /**
  * @brief Represents the flags of this maze card shape.
+ *
+ * The underlying type is fixed so that the loops incrementing a direction past
+ * LEFT stop on a valid value.
  */
-enum MazeDirection
+enum MazeDirection : unsigned
 {
     UP = 1,
     RIGHT = 2,
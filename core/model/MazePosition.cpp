@@ -1,4 +1,5 @@
 #include "MazePosition.h"
+#include "MazeBitboard.h"
 #include <sstream>
 #include <stdexcept>
 
@@ -6,12 +7,12 @@ namespace labyrinth { namespace model {
 
 static unsigned requireValidCoordinate(unsigned coo)
 {
-    std::stringstream errorMessage;
-    errorMessage << "Invalid coordinate! " << coo << " was entered but a";
-    errorMessage << " coordinate should be positive and smaller than the maze";
-    errorMessage << "size.\n";
-    if (8u < coo) {
-        throw std::logic_error(errorMessage.str());
+    if (coo >= MazeBitboard::SIZE) {
+        std::stringstream errorMessage;
+        errorMessage << "Invalid coordinate! " << coo << " was entered but a";
+        errorMessage << " coordinate should be positive and smaller than the maze ";
+        errorMessage << "size.\n";
+        throw std::invalid_argument(errorMessage.str());
     }
     return coo;
 }
@@ -57,10 +58,10 @@ bool MazePosition::hasNeighbor(const MazeDirection &direction) const
         hasNeighBor = row_ > 0;
         break;
     case RIGHT:
-        hasNeighBor = column_ < 6;
+        hasNeighBor = column_ < MazeBitboard::SIZE - 1;
         break;
     case DOWN:
-        hasNeighBor = row_ < 6;
+        hasNeighBor = row_ < MazeBitboard::SIZE - 1;
         break;
     case LEFT:
         hasNeighBor = column_ > 0;
@@ -11,9 +11,28 @@ namespace labyrinth { namespace model {
 class MazePosition
 {
 
+    friend class MazeBitboard;
+    friend class MazeCell;
+
     unsigned row_;
     unsigned column_;
 
+    /**
+     * @brief Tells to construct a position without checking its coordinates.
+     */
+    struct Unchecked {};
+
+    /**
+     * @brief Constructs the position of a cell of the maze, whose coordinates
+     * are known to be valid.
+     *
+     * @param row is the row of this position.
+     * @param column is the column of this position.
+     */
+    MazePosition(unsigned row, unsigned column, Unchecked)
+        : row_{row}, column_{column}
+    {}
+
 public:
 
     /**
@@ -21,6 +40,8 @@ public:
      *
      * @param row is the row of this position.
      * @param column is the column of this position.
+     * @throws std::invalid_argument if a coordinate is not smaller than
+     * MazeBitboard::SIZE.
      */
     MazePosition(unsigned row, unsigned column);
 
@@ -50,6 +71,8 @@ public:
      *
      * @param row is the row of this position.
      * @param column is the column of this position.
+     * @throws std::invalid_argument if a coordinate is not smaller than
+     * MazeBitboard::SIZE.
      */
     void moveTo(unsigned row, unsigned column);
 
@@ -0,0 +1,52 @@
+#include "MoveGenerator.h"
+
+namespace labyrinth { namespace model {
+
+MoveGenerator::MoveGenerator(const Game &game)
+    : nbOfRotations_{game.getMaze().getLastPushedOutMazeCard().getNbOfOrientations()}
+{
+    const Maze &maze = game.getMaze();
+    const Player &current = game.getPlayer(game.getCurrentPlayerIndex());
+    if (current.getState() != Player::State::WAITING) {
+        return;
+    }
+    const unsigned nbOfRotations = nbOfRotations_;
+    shifts_.reserve(Maze::NB_OF_SLOTS * nbOfRotations);
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        if (!maze.isInserrable(slot)) {
+            continue;
+        }
+        Maze rotated = maze;
+        for (unsigned rotation = 0; rotation < nbOfRotations; ++rotation) {
+            Shift shift{slot, rotation, rotated, {}, {}};
+            shift.maze.insertLastPushedOutMazeCardAt(slot);
+            for (unsigned player = 0; player < game.getNbOfPlayers(); ++player) {
+                MazePosition position = game.getPlayer(player).getPosition();
+                shift.playerPositions.push_back(maze.getShiftedPosition(position, slot));
+            }
+            MazePosition start = shift.playerPositions.at(game.getCurrentPlayerIndex());
+            shift.destinations = shift.maze.reachableFrom(start);
+            shifts_.push_back(shift);
+            rotated.getLastPushedOutMazeCard().rotate();
+        }
+    }
+    for (unsigned index = 0; index < shifts_.size(); ++index) {
+        const Shift &shift = shifts_[index];
+        for (MazePosition destination : shift.destinations) {
+            moves_.push_back(Move{Turn{shift.insertion, shift.rotation, destination},
+                                  index});
+        }
+    }
+}
+
+bool MoveGenerator::isLegal(const Turn &turn) const
+{
+    for (const Shift &shift : shifts_) {
+        if (shift.insertion == turn.insertion && shift.rotation == turn.rotation % nbOfRotations_) {
+            return shift.destinations.contains(turn.destination);
+        }
+    }
+    return false;
+}
+
+}}
@@ -0,0 +1,147 @@
+#ifndef MOVEGENERATOR_H
+#define MOVEGENERATOR_H
+
+#include <vector>
+
+#include "Game.h"
+#include "Maze.h"
+#include "CellSet.h"
+#include "Turn.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Generates every legal complete turn of the current player of a game.
+ *
+ * A turn is made of one of the inserrable slots, one of the distinct rotations
+ * of the current maze card and one of the positions the current player can
+ * reach after the insertion. Only 2 rotations of an I card are generated, the
+ * 2 others giving the same boards. The given game is neither modified nor notified, and
+ * no exception is used to tell legal turns apart.
+ */
+class MoveGenerator
+{
+
+public:
+
+    /**
+     * @brief Represents the board resulting from the insertion of the rotated
+     * current maze card at a slot.
+     */
+    struct Shift
+    {
+
+        /**
+         * @brief Is the position the current maze card is inserted at.
+         */
+        MazePosition insertion;
+
+        /**
+         * @brief Is the number of quarter turns applied to the current maze
+         * card before its insertion.
+         */
+        unsigned rotation;
+
+        /**
+         * @brief Is the maze after the insertion.
+         */
+        Maze maze;
+
+        /**
+         * @brief Are the positions of the players after the insertion, indexed
+         * like the players of the game.
+         */
+        std::vector<MazePosition> playerPositions;
+
+        /**
+         * @brief Are the positions the current player can move to after the
+         * insertion.
+         */
+        CellSet destinations;
+
+    };
+
+    /**
+     * @brief Represents a complete turn and its resulting state. The resulting
+     * state is the board of the shift with the current player moved to the
+     * destination of the turn.
+     */
+    struct Move
+    {
+
+        /**
+         * @brief Is the turn to play.
+         */
+        Turn turn;
+
+        /**
+         * @brief Is the index of the resulting board in getShifts.
+         */
+        unsigned shift;
+
+    };
+
+private:
+
+    /**
+     * @brief Are the boards resulting from every legal insertion.
+     */
+    std::vector<Shift> shifts_;
+
+    /**
+     * @brief Are all the legal turns.
+     */
+    std::vector<Move> moves_;
+
+    /**
+     * @brief Is the number of distinct rotations of the current maze card.
+     */
+    unsigned nbOfRotations_;
+
+public:
+
+    /**
+     * @brief Generates the legal turns of the current player of the given game.
+     * If the current player already moved the pathways, no turn is generated.
+     *
+     * @param game is the game to generate the turns for.
+     */
+    explicit MoveGenerator(const Game &game);
+
+    /**
+     * @brief Gets the boards resulting from every legal insertion.
+     *
+     * @return the boards of the legal insertions.
+     */
+    const std::vector<Shift> &getShifts() const { return shifts_; }
+
+    /**
+     * @brief Gets all the legal turns of the current player.
+     *
+     * @return the legal turns.
+     */
+    const std::vector<Move> &getMoves() const { return moves_; }
+
+    /**
+     * @brief Gets the board resulting from the insertion of the given move.
+     *
+     * @param move is one of the generated moves.
+     * @return the board of the move.
+     */
+    const Shift &getShiftOf(const Move &move) const { return shifts_.at(move.shift); }
+
+    /**
+     * @brief Tells if the given turn is legal for the current player. A
+     * rotation giving the same board as a generated one is legal too.
+     *
+     * @param turn is the turn to check.
+     * @return true if the turn is one of the generated turns, up to the
+     * rotations of the current maze card.
+     */
+    bool isLegal(const Turn &turn) const;
+
+};
+
+}}
+
+#endif // MOVEGENERATOR_H
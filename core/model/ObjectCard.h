@@ -53,6 +53,11 @@ public:
      */
     void turnOver() { isTurnedOver_ = true; }
 
+    /**
+     * @brief Turns this card back, as if its object was not found yet.
+     */
+    void turnBack() { isTurnedOver_ = false; }
+
 };
 
 }}
@@ -45,6 +45,14 @@ bool ObjectivesDeck::areAllCardsTurnedOver() const {
     return true;
 }
 
+unsigned ObjectivesDeck::getNbOfTurnedOverCards() const {
+    unsigned count = 0;
+    for (const auto &card : cards_) {
+        if (card.isTurnedOver()) ++count;
+    }
+    return count;
+}
+
 ObjectCard &ObjectivesDeck::getCurrentCard(){
     for(unsigned card{0}; card<cards_.size();++card){
         if(!cards_.at(card).isTurnedOver()){
@@ -54,6 +62,17 @@ ObjectCard &ObjectivesDeck::getCurrentCard(){
     throw std::logic_error("No object card to get anymore.");
 }
 
+ObjectCard &ObjectivesDeck::turnLastCardBack()
+{
+    for (unsigned card = static_cast<unsigned>(cards_.size()); 0 < card; --card) {
+        if (cards_.at(card - 1).isTurnedOver()) {
+            cards_.at(card - 1).turnBack();
+            return cards_.at(card - 1);
+        }
+    }
+    throw std::logic_error("No object card is turned over.");
+}
+
 void ObjectivesDeck::turnOverAllCards()
 {
     for (auto &card : cards_) card.turnOver();
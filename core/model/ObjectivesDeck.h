@@ -51,6 +51,48 @@ public:
      */
     labyrinth::model::ObjectCard &getCurrentCard();
 
+    /**
+     * @brief Turns the last turned over card of this deck back. The cards are
+     * turned over in order, so this undoes the last turn over.
+     *
+     * @return the card turned back.
+     * @throws std::logic_error if no card is turned over.
+     */
+    labyrinth::model::ObjectCard &turnLastCardBack();
+
+    /**
+     * @brief Gets the card of this deck at the given index.
+     *
+     * @param index is the index of the card, in the order of the deck.
+     * @return the card at the given index.
+     */
+    labyrinth::model::ObjectCard &getCard(unsigned index) { return cards_.at(index); }
+
+    /**
+     * @brief Gets the card of this deck at the given index.
+     *
+     * @param index is the index of the card, in the order of the deck.
+     * @return the card at the given index.
+     */
+    const labyrinth::model::ObjectCard &getCard(unsigned index) const { return cards_.at(index); }
+
+    /**
+     * @brief Gets the number of cards of this deck.
+     *
+     * @return the number of cards of this deck.
+     */
+    unsigned getNbOfCards() const { return static_cast<unsigned>(cards_.size()); }
+
+    /**
+     * @brief Gets the index of the given card of this deck.
+     *
+     * @param card is a card of this deck.
+     * @return the index of the card, in the order of the deck.
+     */
+    unsigned indexOf(const ObjectCard &card) const {
+        return static_cast<unsigned>(&card - cards_.data());
+    }
+
     /**
      * @brief Gets this deck cards.
      *
@@ -65,6 +107,13 @@ public:
      */
     bool areAllCardsTurnedOver() const;
 
+    /**
+     * @brief Gets the number of cards of this deck that are turned over.
+     *
+     * @return the number of turned over cards.
+     */
+    unsigned getNbOfTurnedOverCards() const;
+
     /**
      * @brief Turn all the cards of this deck over. This method is used for
      * unit testing.
@@ -0,0 +1,144 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <cassert>
+#include <cstdint>
+
+#include "MazeBitboard.h"
+#include "MazeCell.h"
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Tells which players stand on each cell of the maze. Each cell keeps a
+ * mask with one bit per player, the bit of a player being his/ her color.
+ */
+class Occupancy
+{
+
+    /**
+     * @brief Are the players standing on each cell.
+     */
+    std::uint8_t masks_[MazeBitboard::CELLS];
+
+    /**
+     * @brief Are the cells on which at least one player stands.
+     */
+    Bitboard occupied_;
+
+    static unsigned getCellOf(const MazePosition &position) {
+        return MazeBitboard::getCell(position);
+    }
+
+public:
+
+    /**
+     * @brief Constructs an index on which no player stands.
+     */
+    Occupancy()
+        : masks_{},
+          occupied_{0}
+    {}
+
+    /**
+     * @brief Gets the players standing at the given position.
+     *
+     * @param position is the position to look at.
+     * @return the mask of the players at the position, the bit of a player
+     * being his/ her color. 0 if the position is outside of the maze.
+     */
+    std::uint8_t getPlayersAt(const MazePosition &position) const {
+        return MazeBitboard::isInside(position) ? masks_[getCellOf(position)] : 0;
+    }
+
+    /**
+     * @brief Tells if a player stands at the given position.
+     *
+     * @param position is the position to look at.
+     * @return true if at least one player stands at the position.
+     */
+    bool isOccupied(const MazePosition &position) const {
+        return getPlayersAt(position) != 0;
+    }
+
+    /**
+     * @brief Gets the cells on which at least one player stands.
+     *
+     * @return the occupied cells.
+     */
+    Bitboard getOccupiedCells() const { return occupied_; }
+
+    /**
+     * @brief Puts the given player on the given cell.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param cell is the cell of the player.
+     */
+    void add(unsigned player, MazeCell cell) {
+        masks_[cell.getIndex()] |= static_cast<std::uint8_t>(1u << player);
+        occupied_ |= cell.getBit();
+    }
+
+    /**
+     * @brief Removes the given player from the given cell.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param cell is the cell the player stands on.
+     */
+    void remove(unsigned player, MazeCell cell) {
+        masks_[cell.getIndex()] &= static_cast<std::uint8_t>(~(1u << player));
+        if (masks_[cell.getIndex()] == 0) occupied_ &= ~cell.getBit();
+    }
+
+    /**
+     * @brief Moves the given player from a cell to another.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param from is the cell the player leaves.
+     * @param to is the cell the player moves to.
+     */
+    void move(unsigned player, MazeCell from, MazeCell to) {
+        remove(player, from);
+        add(player, to);
+    }
+
+    /**
+     * @brief Puts the given player at the given position.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param position is a position inside the maze.
+     */
+    void add(unsigned player, const MazePosition &position) {
+        assert(MazeBitboard::isInside(position));
+        add(player, MazeCell{getCellOf(position)});
+    }
+
+    /**
+     * @brief Removes the given player from the given position.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param position is a position inside the maze.
+     */
+    void remove(unsigned player, const MazePosition &position) {
+        assert(MazeBitboard::isInside(position));
+        remove(player, MazeCell{getCellOf(position)});
+    }
+
+    /**
+     * @brief Moves the given player from a position to another.
+     *
+     * @param player is the bit of the player, between 0 and 7.
+     * @param from is the position the player leaves.
+     * @param to is the position the player moves to.
+     */
+    void move(unsigned player, const MazePosition &from, const MazePosition &to) {
+        remove(player, from);
+        add(player, to);
+    }
+
+};
+
+}}
+
+#endif // OCCUPANCY_H
@@ -1,8 +1,11 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
+#include "MazeBitboard.h"
+#include "MazeCell.h"
 #include "MazePosition.h"
 #include "ObjectivesDeck.h"
+#include "Occupancy.h"
 #include <iostream>
 #include <vector>
 #include <string>
@@ -16,9 +19,10 @@ namespace labyrinth { namespace model {
 struct Player {
 
     /**
-     * @brief Represents the color of a player.
+     * @brief Represents the color of a player. The underlying type is fixed
+     * so that the loops incrementing a color past GREEN stop on a valid value.
      */
-    enum Color
+    enum Color : unsigned
     {
         RED,
         BLUE,
@@ -59,9 +63,9 @@ private:
     Color color_;
 
     /**
-     * @brief Is the position in the maze of this player.
+     * @brief Is the cell of the maze this player stands on.
      */
-    MazePosition position_;
+    MazeCell cell_;
 
     /**
      * @brief Is the state of this player.
@@ -79,6 +83,13 @@ private:
      */
     ObjectCard *currentObjective_;
 
+    /**
+     * @brief Is the occupancy index of the game this player takes part in,
+     * kept up to date with the position of this player. A copy of this player
+     * is not attached to any index.
+     */
+    Occupancy *occupancy_;
+
 public:
 
     /**
@@ -92,10 +103,11 @@ public:
      */
     Player(Color color, MazePosition position=MazePosition{0, 0})
         : color_{color},
-          position_{position},
+          cell_{MazeCell::of(position)},
           state_{State::WAITING},
           objectives_{},
-          currentObjective_{nullptr}
+          currentObjective_{nullptr},
+          occupancy_{nullptr}
     {}
 
     /**
@@ -103,12 +115,30 @@ public:
      */
     Player()
         : color_{BLUE},
-          position_{},
+          cell_{},
           state_{State::WAITING},
           objectives_{},
-          currentObjective_{nullptr}
+          currentObjective_{nullptr},
+          occupancy_{nullptr}
     {}
 
+    /**
+     * @brief Constructs a copy of the given player. The copy is not attached
+     * to the occupancy index of the given player.
+     *
+     * @param that is the player to copy.
+     */
+    Player(const Player &that)
+        : color_{that.color_},
+          cell_{that.cell_},
+          state_{that.state_},
+          objectives_{that.objectives_},
+          currentObjective_{nullptr},
+          occupancy_{nullptr}
+    {
+        copyCurrentObjectiveOf(that);
+    }
+
     /**
      * @brief Gets this player color.
      *
@@ -128,9 +158,45 @@ public:
      *
      * @return this player position.
      */
-    MazePosition getPosition() const{ return position_; }
+    MazePosition getPosition() const{ return cell_.getPosition(); }
+
+    /**
+     * @brief Gets the cell this player stands on.
+     *
+     * @return this player cell.
+     */
+    MazeCell getCell() const { return cell_; }
+
+    /**
+     * @brief Sets this player position.
+     *
+     * @param position is the new position of this player.
+     * @throws std::invalid_argument if the position is outside of the maze.
+     */
+    void setPosition(const MazePosition &position) { setCell(MazeCell::of(position)); }
 
-    void setPosition(const MazePosition &position){position_ = position;}
+    /**
+     * @brief Moves this player to the given cell.
+     *
+     * @param cell is the new cell of this player.
+     */
+    void setCell(MazeCell cell) {
+        if (occupancy_) occupancy_->move(color_, cell_, cell);
+        cell_ = cell;
+    }
+
+    /**
+     * @brief Attaches this player to the given occupancy index, which is then
+     * updated each time this player moves. This player is removed from his/
+     * her previous index.
+     *
+     * @param occupancy is the index to attach to, or nullptr to detach.
+     */
+    void setOccupancy(Occupancy *occupancy) {
+        if (occupancy_) occupancy_->remove(color_, cell_);
+        occupancy_ = occupancy;
+        if (occupancy_) occupancy_->add(color_, cell_);
+    }
 
     /**
      * @brief Tells if a player is at the given position.
@@ -138,7 +204,7 @@ public:
      * @param position is the position of this player.
      * @return true if this player is at the given position.
      */
-    bool isAt(const MazePosition &position) const { return position == position_; }
+    bool isAt(const MazePosition &position) const { return position == getPosition(); }
 
     /**
      * @brief Gets this player current objective.
@@ -152,7 +218,7 @@ public:
      *
      * @return the objectives of this player.
      */
-    ObjectivesDeck getObjectives() const { return objectives_; }
+    const ObjectivesDeck &getObjectives() const { return objectives_; }
 
     /**
      * @brief Gets the objective of this player.
@@ -188,11 +254,19 @@ public:
         return objectives_.areAllCardsTurnedOver();
     }
 
+    /**
+     * @brief Gets the number of objectives this player has found.
+     *
+     * @return the number of objectives this player has found.
+     */
+    unsigned getNbOfFoundObjectives() const {
+        return objectives_.getNbOfTurnedOverCards();
+    }
+
     bool isGoodPosition(const MazePosition &position) const{
-        return (position.getColumn() == 0 && position.getRow() == 0) ||
-                (position.getColumn() == 6 && position.getRow() == 0) ||
-                (position.getColumn() == 0 && position.getRow() == 6) ||
-                (position.getColumn()==6 && position.getRow()==6);
+        const unsigned last = MazeBitboard::SIZE - 1;
+        return (position.getColumn() == 0 || position.getColumn() == last) &&
+                (position.getRow() == 0 || position.getRow() == last);
     }
 
     bool isWaiting(){
@@ -219,22 +293,41 @@ public:
     }
 
     /**
-     * @brief Tells if this player got back to its starting position.
+     * @brief Gets the starting position of this player. Each color starts in
+     * its own corner of the maze.
      *
-     * @return true if this player got back to its starting position.
+     * @return the starting position of this player.
      */
-    bool isReturnedToInitialPos() const {
+    MazePosition getInitialPosition() const { return getInitialCell().getPosition(); }
+
+    /**
+     * @brief Gets the cell this player starts from, its own corner of the
+     * maze.
+     *
+     * @return the starting cell of this player.
+     */
+    MazeCell getInitialCell() const {
+        const unsigned last = MazeBitboard::SIZE - 1;
         switch(color_){
         case Color::RED :
-            return position_.getRow() == 0 && position_.getColumn() == 0;
+            return MazeCell{0};
+        case Color::BLUE :
+            return MazeCell{last};
         case Color::YELLOW :
-            return position_.getRow() == 0 && position_.getColumn() == 6;
+            return MazeCell{last * MazeBitboard::SIZE};
         case Color::GREEN :
-            return position_.getRow() == 6 && position_.getColumn() == 0;
-        case Color::BLUE :
-            return position_.getRow() == 6 && position_.getColumn() == 6;
+            return MazeCell{MazeBitboard::CELLS - 1};
         }
-        return false;
+        return MazeCell{};
+    }
+
+    /**
+     * @brief Tells if this player got back to its starting position.
+     *
+     * @return true if this player got back to its starting position.
+     */
+    bool isReturnedToInitialPos() const {
+        return cell_ == getInitialCell();
     }
 
     /**
@@ -243,13 +336,22 @@ public:
      * @param row is the row of this player position.
      * @param column is the column of this player position.
      */
-    void moveTo(unsigned row, unsigned column) { position_.moveTo(row, column); }
+    void moveTo(unsigned row, unsigned column) { setPosition(MazePosition{row, column}); }
 
     /**
      * @brief Turns the current objective over.
      */
     void turnCurrentObjectiveOver() { currentObjective_->turnOver(); }
 
+    /**
+     * @brief Turns the last found objective back and makes it the current
+     * objective again. This undoes a turnCurrentObjectiveOver followed by a
+     * nextObjective.
+     *
+     * @throws std::logic_error if no objective is found.
+     */
+    void restoreLastObjective() { currentObjective_ = &objectives_.turnLastCardBack(); }
+
     /**
      * @brief Sets the player current objective to the next one. After setting
      * this player deck, a call to this method set the player current objective
@@ -298,20 +400,40 @@ public:
     }
 
     /**
-     * @brief Assigns the given player to this one.
+     * @brief Assigns the given player to this one. This player stays attached
+     * to his/ her own occupancy index.
      * @param that is the player to assign.
      * @return this player.
      */
     Player& operator=(const Player &that)
     {
+        if (occupancy_) {
+            occupancy_->remove(color_, cell_);
+            occupancy_->add(that.color_, that.cell_);
+        }
         color_ = that.color_;
-        position_ = that.position_;
+        cell_ = that.cell_;
         state_ = that.state_;
         objectives_ = that.objectives_;
-        currentObjective_ = that.currentObjective_;
+        copyCurrentObjectiveOf(that);
         return *this;
     }
 
+private:
+
+    /**
+     * @brief Sets the current objective of this player to the card of his/ her
+     * own deck matching the current objective of the given player, whose deck
+     * was just copied.
+     *
+     * @param that is the player whose deck this player holds a copy of.
+     */
+    void copyCurrentObjectiveOf(const Player &that) {
+        currentObjective_ = that.currentObjective_
+                ? &objectives_.getCard(that.objectives_.indexOf(*that.currentObjective_))
+                : nullptr;
+    }
+
 };
 
 inline Player::Color &operator++(Player::Color &color) {
@@ -0,0 +1,30 @@
+#ifndef RANDOMENGINE_H
+#define RANDOMENGINE_H
+
+#include <chrono>
+#include <random>
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Is the random engine used to set up a maze and deal the objectives.
+ * A maze or a game built twice from engines with the same seed is the same.
+ */
+typedef std::mt19937 RandomEngine;
+
+/**
+ * @brief Gets a new seed for a random engine. Each thread draws its seeds from
+ * its own generator, so concurrent calls do not contend.
+ *
+ * @return a seed that differs from one call to another.
+ */
+inline unsigned getRandomSeed() {
+    static thread_local RandomEngine seeds{std::random_device{}()
+                ^ static_cast<unsigned>(std::chrono::high_resolution_clock::now()
+                                        .time_since_epoch().count())};
+    return static_cast<unsigned>(seeds());
+}
+
+}}
+
+#endif // RANDOMENGINE_H
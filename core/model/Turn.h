@@ -0,0 +1,40 @@
+#ifndef TURN_H
+#define TURN_H
+
+#include "MazePosition.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Represents a complete turn of a player: the current maze card is
+ * rotated, inserted in the maze, then the player moves his/ her piece.
+ */
+struct Turn
+{
+
+    /**
+     * @brief Is the position the current maze card is inserted at.
+     */
+    MazePosition insertion;
+
+    /**
+     * @brief Is the number of quarter turns applied to the current maze card
+     * before its insertion, between 0 and 3.
+     */
+    unsigned rotation;
+
+    /**
+     * @brief Is the position the player moves his/ her piece to.
+     */
+    MazePosition destination;
+
+};
+
+inline bool operator==(const Turn &lhs, const Turn &rhs) {
+    return lhs.insertion == rhs.insertion && lhs.rotation == rhs.rotation
+            && lhs.destination == rhs.destination;
+}
+
+}}
+
+#endif // TURN_H
@@ -0,0 +1,69 @@
+#ifndef TURNRECORD_H
+#define TURNRECORD_H
+
+#include <cstdint>
+
+#include "CellSet.h"
+#include "MazePosition.h"
+#include "Turn.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Is what a turn applied to a game changed, so that the turn can be
+ * undone. It holds a few positions and flags only, the cards and the decks
+ * are not copied.
+ */
+struct TurnRecord
+{
+
+    /**
+     * @brief Is the turn that has been applied.
+     */
+    Turn turn;
+
+    /**
+     * @brief Is the index of the player who played the turn.
+     */
+    std::uint8_t player;
+
+    /**
+     * @brief Tells if the player found his/ her objective during the turn.
+     */
+    bool hasFoundObjective;
+
+    /**
+     * @brief Are the cells of the players before the turn, by player index.
+     */
+    std::uint8_t playerCells[4];
+
+    /**
+     * @brief Is the last pushed out position of the maze before the turn.
+     */
+    MazePosition blockedPosition;
+
+    /**
+     * @brief Are the last shifted cells of the maze before the turn.
+     */
+    CellSet shiftedCells;
+
+    /**
+     * @brief Are the last changed cells of the maze before the turn.
+     */
+    CellSet changedCells;
+
+    /**
+     * @brief Is the selected insertion position before the turn.
+     */
+    MazePosition selectedInsertionPosition;
+
+    /**
+     * @brief Is the selected player position before the turn.
+     */
+    MazePosition selectedPlayerPosition;
+
+};
+
+}}
+
+#endif // TURNRECORD_H
@@ -0,0 +1,103 @@
+#include "Zobrist.h"
+#include "MazeBitboard.h"
+
+#include <cstddef>
+
+namespace labyrinth { namespace model {
+
+constexpr unsigned Zobrist::MAX_NB_OF_OBJECTIVES;
+
+static const unsigned NB_OF_SHAPES = 16;
+static const unsigned NB_OF_OBJECTS = NONE + 1;
+static const unsigned MAX_NB_OF_PLAYERS = 4;
+static const unsigned NB_OF_PHASES = 3;
+
+/**
+ * @brief Are the random keys. They are always generated from the same seed so
+ * that keys are stable from one run to another.
+ */
+struct ZobristTables
+{
+    std::uint64_t shapes[MazeBitboard::CELLS][NB_OF_SHAPES];
+    std::uint64_t objects[MazeBitboard::CELLS][NB_OF_OBJECTS];
+    std::uint64_t spareShapes[NB_OF_SHAPES];
+    std::uint64_t spareObjects[NB_OF_OBJECTS];
+    std::uint64_t blocked[MazeBitboard::CELLS];
+    std::uint64_t players[MAX_NB_OF_PLAYERS][MazeBitboard::CELLS];
+    std::uint64_t progress[MAX_NB_OF_PLAYERS][Zobrist::MAX_NB_OF_OBJECTIVES + 1];
+    std::uint64_t turns[MAX_NB_OF_PLAYERS][NB_OF_PHASES];
+
+    ZobristTables()
+    {
+        std::uint64_t state = 0x4C414259u;
+        fill(&shapes[0][0], sizeof(shapes), state);
+        fill(&objects[0][0], sizeof(objects), state);
+        fill(spareShapes, sizeof(spareShapes), state);
+        fill(spareObjects, sizeof(spareObjects), state);
+        fill(blocked, sizeof(blocked), state);
+        fill(&players[0][0], sizeof(players), state);
+        fill(&progress[0][0], sizeof(progress), state);
+        fill(&turns[0][0], sizeof(turns), state);
+    }
+
+    /**
+     * @brief Fills the given table with keys.
+     */
+    static void fill(std::uint64_t *keys, std::size_t bytes, std::uint64_t &state)
+    {
+        for (std::size_t i = 0; i < bytes / sizeof(std::uint64_t); ++i) {
+            keys[i] = nextKey(state);
+        }
+    }
+
+    /**
+     * @brief Generates the next key with the splitmix64 generator.
+     */
+    static std::uint64_t nextKey(std::uint64_t &state)
+    {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15u);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+        return z ^ (z >> 31);
+    }
+};
+
+static const ZobristTables &getTables()
+{
+    static const ZobristTables tables;
+    return tables;
+}
+
+std::uint64_t Zobrist::getCardKey(unsigned cell, unsigned shape, Object object)
+{
+    const ZobristTables &tables = getTables();
+    return tables.shapes[cell][shape] ^ tables.objects[cell][object];
+}
+
+std::uint64_t Zobrist::getSpareCardKey(unsigned shape, Object object)
+{
+    const ZobristTables &tables = getTables();
+    return tables.spareShapes[shape] ^ tables.spareObjects[object];
+}
+
+std::uint64_t Zobrist::getBlockedKey(unsigned cell)
+{
+    return getTables().blocked[cell];
+}
+
+std::uint64_t Zobrist::getPlayerKey(unsigned player, unsigned cell)
+{
+    return getTables().players[player][cell];
+}
+
+std::uint64_t Zobrist::getProgressKey(unsigned player, unsigned found)
+{
+    return getTables().progress[player][found];
+}
+
+std::uint64_t Zobrist::getTurnKey(unsigned player, unsigned phase)
+{
+    return getTables().turns[player][phase];
+}
+
+}}
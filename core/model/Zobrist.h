@@ -0,0 +1,87 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+
+#include "Object.h"
+
+namespace labyrinth { namespace model {
+
+/**
+ * @brief Gives the random keys used to hash a game state with the Zobrist
+ * method.
+ *
+ * The key of a state is the exclusive or of the keys of its components. A
+ * change of one component is thus reflected by xoring its old key out and
+ * its new key in.
+ *
+ * More informations on Zobrist hashing here:
+ * https://en.wikipedia.org/wiki/Zobrist_hashing
+ */
+struct Zobrist
+{
+
+    /**
+     * @brief Is the maximal number of objectives a player can find.
+     */
+    static constexpr unsigned MAX_NB_OF_OBJECTIVES = 12;
+
+    /**
+     * @brief Gets the key of a maze card located at the given cell.
+     *
+     * @param cell is the index of the cell of the card.
+     * @param shape is the value of the shape of the card.
+     * @param object is the object of the card.
+     * @return the key of the card at the cell.
+     */
+    static std::uint64_t getCardKey(unsigned cell, unsigned shape, Object object);
+
+    /**
+     * @brief Gets the key of the last pushed out maze card.
+     *
+     * @param shape is the value of the shape of the card.
+     * @param object is the object of the card.
+     * @return the key of the last pushed out card.
+     */
+    static std::uint64_t getSpareCardKey(unsigned shape, Object object);
+
+    /**
+     * @brief Gets the key of the position blocked by the last push out.
+     *
+     * @param cell is the index of the cell of the blocked position.
+     * @return the key of the blocked position.
+     */
+    static std::uint64_t getBlockedKey(unsigned cell);
+
+    /**
+     * @brief Gets the key of a player standing at the given cell.
+     *
+     * @param player is the index of the player.
+     * @param cell is the index of the cell of the player.
+     * @return the key of the player position.
+     */
+    static std::uint64_t getPlayerKey(unsigned player, unsigned cell);
+
+    /**
+     * @brief Gets the key of the number of objectives found by a player.
+     *
+     * @param player is the index of the player.
+     * @param found is the number of objectives the player found.
+     * @return the key of the player progress.
+     */
+    static std::uint64_t getProgressKey(unsigned player, unsigned found);
+
+    /**
+     * @brief Gets the key of the current player and of his/ her turn phase.
+     *
+     * @param player is the index of the current player.
+     * @param phase is the state of the current player (see Player::State).
+     * @return the key of the current player.
+     */
+    static std::uint64_t getTurnKey(unsigned player, unsigned phase);
+
+};
+
+}}
+
+#endif // ZOBRIST_H
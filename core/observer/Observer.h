@@ -14,6 +14,19 @@ namespace nvs
 
 class Subject;
 
+/*!
+ * \brief Ensemble de drapeaux décrivant ce qui a changé dans un sujet
+ * d'observation.
+ *
+ * La signification de chaque bit est définie par le sujet concret.
+ */
+typedef unsigned Changes;
+
+/*!
+ * \brief Drapeaux signalant que tout a pu changer.
+ */
+constexpr Changes ALL_CHANGES = ~0u;
+
 /*!
  * \brief Classe abstraite de base de tout observateur.
  *
@@ -38,6 +51,22 @@ class Observer
      */
     virtual void update(const Subject * subject) = 0;
 
+    /*!
+     * \brief Méthode appelée par le sujet observé lors d'une notification,
+     * avec les drapeaux de ce qui a changé depuis la notification précédente.
+     *
+     * Par défaut, elle ignore les drapeaux et invoque update(const Subject *).
+     *
+     * \param subject le sujet d'observation qui notifie un changement.
+     * \param changes les drapeaux de ce qui a changé.
+     * \see Subject::notifyObservers(Changes).
+     */
+    virtual void update(const Subject * subject, Changes changes)
+    {
+        (void) changes;
+        update(subject);
+    }
+
     /*!
      * \brief Destructeur virtuel par défaut car utilisation polymorphique.
      */
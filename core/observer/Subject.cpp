@@ -1,30 +1,58 @@
-/*!
- * \file subject.cpp
- * \brief Implémentation de la classe nvs::Subject.
- */
-
-#include "Subject.h"
-#include "Observer.h"
-
-namespace nvs
-{
-
-void Subject::registerObserver(Observer * observer)
-{
-    observers_.insert(observer);
-}
-
-void Subject::unregisterObserver(Observer * observer)
-{
-    observers_.erase(observer);
-}
-
-void Subject::notifyObservers() const
-{
-    for (Observer * observer : observers_)
-    {
-        observer->update(this);
-    }
-}
-
-} // namespace nvs
+/*!
+ * \file subject.cpp
+ * \brief Implémentation de la classe nvs::Subject.
+ */
+
+#include "Subject.h"
+#include "Observer.h"
+
+namespace nvs
+{
+
+void Subject::registerObserver(Observer * observer)
+{
+    observers_.insert(observer);
+}
+
+void Subject::unregisterObserver(Observer * observer)
+{
+    observers_.erase(observer);
+}
+
+void Subject::beginNotifications()
+{
+    ++batchDepth_;
+}
+
+void Subject::commitNotifications()
+{
+    if (batchDepth_ > 0 && --batchDepth_ == 0 && pendingChanges_ != 0)
+    {
+        Changes changes = pendingChanges_;
+        pendingChanges_ = 0;
+        notifyObservers(changes);
+    }
+}
+
+void Subject::abortNotifications()
+{
+    if (batchDepth_ > 0 && --batchDepth_ == 0)
+    {
+        pendingChanges_ = 0;
+    }
+}
+
+void Subject::notifyObservers(Changes changes) const
+{
+    if (batchDepth_ > 0)
+    {
+        pendingChanges_ |= changes;
+        return;
+    }
+    for (Observer * observer : observers_)
+    {
+        observer->update(this, changes);
+    }
+}
+
+} // namespace nvs
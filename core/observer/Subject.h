@@ -1,123 +1,223 @@
-/*!
- * \file subject.h
- * \brief Définition de la classe nvs::Subject.
- */
-
-#ifndef __SUBJECT__H__
-#define __SUBJECT__H__
-
-#include <set>
-
-/*!
- * \brief Espace de nom de Nicolas Vansteenkiste.
- */
-namespace nvs
-{
-
-class Observer;
-
-/*!
- * \brief Classe de base de tout "sujet d'observation".
- *
- * Classe dont dérive toute source d'événement (ou "sujet d'observation")
- * du modèle de conception "Observateur / SujetDObservation".
- *
- * \sa Observer.
- */
-class Subject
-{
-  public:
-
-    /*!
-     * \brief Destructeur virtuel par défaut car utilisation polymorphique.
-     */
-    virtual ~Subject() = default;
-
-    /*!
-     * \brief Constructeur par recopie par défaut.
-     *
-     * Le destructeur virtuel par défaut a des effets en cascade.
-     *
-     * \see http://stackoverflow.com/q/33957037
-     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
-     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
-     */
-    Subject(const Subject &) = default;
-
-    /*!
-     * \brief Constructeur par déplacement par défaut.
-     *
-     * Le destructeur virtuel par défaut a des effets en cascade.
-     *
-     * \see http://stackoverflow.com/q/33957037
-     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
-     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
-     */
-    Subject(Subject &&) = default;
-
-    /*!
-     * \brief Opérateur d'assignation par recopie par défaut.
-     *
-     * Le destructeur virtuel par défaut a des effets en cascade.
-     *
-     * \see http://stackoverflow.com/q/33957037
-     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
-     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
-     */
-    Subject & operator=(const Subject &) = default;
-
-    /*!
-     * \brief Opérateur d'assignation par déplacement par défaut.
-     *
-     * Le destructeur virtuel par défaut a des effets en cascade.
-     *
-     * \see http://stackoverflow.com/q/33957037
-     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
-     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
-     */
-    Subject & operator=(Subject &&) = default;
-
-    /*!
-     * \brief Méthode permettant à un observateur de s'enregistrer comme
-     * écouteur du sujet d'observation.
-     *
-     * \param observer un pointeur vers le candidat observateur.
-     */
-    virtual void registerObserver(Observer * observer) final;
-
-    /*!
-     * \brief Méthode permettant à un observateur de se retirer de la liste
-     * des écouteurs patentés du sujet d'observation.
-     *
-     * \param observer l'adresse de l'observateur désintéressé.
-     */
-    virtual void unregisterObserver(Observer * observer) final;
-
-  protected:
-
-    /*!
-     * \brief Constructeur protégé pour éviter l'instanciation
-     *        hors héritage.
-     */
-    Subject() = default;
-
-    /*!
-     * \brief Méthode qui se charge de prévenir les observateurs d'un
-     * changement d'état du sujet d'observation, en invoquant leur
-     * méthode Observer::update().
-     *
-     * \sa Observer::update(const Subject *).
-     */
-    virtual void notifyObservers() const final;
-
-  protected:
-
-    /*!
-     * \brief L'ensemble d'observateurs enregistrés.
-     */
-    std::set<Observer *> observers_ { };
-};
-
-} // namespace nvs
-
-#endif
+/*!
+ * \file subject.h
+ * \brief Définition de la classe nvs::Subject.
+ */
+
+#ifndef __SUBJECT__H__
+#define __SUBJECT__H__
+
+#include <set>
+
+#include "Observer.h"
+
+/*!
+ * \brief Espace de nom de Nicolas Vansteenkiste.
+ */
+namespace nvs
+{
+
+/*!
+ * \brief Classe de base de tout "sujet d'observation".
+ *
+ * Classe dont dérive toute source d'événement (ou "sujet d'observation")
+ * du modèle de conception "Observateur / SujetDObservation".
+ *
+ * \sa Observer.
+ */
+class Subject
+{
+  public:
+
+    /*!
+     * \brief Destructeur virtuel par défaut car utilisation polymorphique.
+     */
+    virtual ~Subject() = default;
+
+    /*!
+     * \brief Constructeur par recopie par défaut.
+     *
+     * Le destructeur virtuel par défaut a des effets en cascade.
+     *
+     * \see http://stackoverflow.com/q/33957037
+     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
+     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
+     */
+    Subject(const Subject &) = default;
+
+    /*!
+     * \brief Constructeur par déplacement par défaut.
+     *
+     * Le destructeur virtuel par défaut a des effets en cascade.
+     *
+     * \see http://stackoverflow.com/q/33957037
+     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
+     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
+     */
+    Subject(Subject &&) = default;
+
+    /*!
+     * \brief Opérateur d'assignation par recopie par défaut.
+     *
+     * Le destructeur virtuel par défaut a des effets en cascade.
+     *
+     * \see http://stackoverflow.com/q/33957037
+     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
+     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
+     */
+    Subject & operator=(const Subject &) = default;
+
+    /*!
+     * \brief Opérateur d'assignation par déplacement par défaut.
+     *
+     * Le destructeur virtuel par défaut a des effets en cascade.
+     *
+     * \see http://stackoverflow.com/q/33957037
+     * \see http://scottmeyers.blogspot.de/2014/03/a-concern-about-rule-of-zero.html
+     * \see https://blog.feabhas.com/2015/11/becoming-a-rule-of-zero-hero/
+     */
+    Subject & operator=(Subject &&) = default;
+
+    /*!
+     * \brief Méthode permettant à un observateur de s'enregistrer comme
+     * écouteur du sujet d'observation.
+     *
+     * \param observer un pointeur vers le candidat observateur.
+     */
+    virtual void registerObserver(Observer * observer) final;
+
+    /*!
+     * \brief Méthode permettant à un observateur de se retirer de la liste
+     * des écouteurs patentés du sujet d'observation.
+     *
+     * \param observer l'adresse de l'observateur désintéressé.
+     */
+    virtual void unregisterObserver(Observer * observer) final;
+
+    /*!
+     * \brief Ouvre une transaction de notifications.
+     *
+     * Jusqu'à la fermeture de la transaction, les notifications ne sont pas
+     * envoyées mais leurs drapeaux sont cumulés. Les transactions peuvent
+     * être imbriquées : seule la fermeture de la plus externe notifie.
+     *
+     * \sa commitNotifications().
+     */
+    void beginNotifications();
+
+    /*!
+     * \brief Ferme une transaction de notifications.
+     *
+     * À la fermeture de la transaction la plus externe, chaque observateur
+     * est notifié une seule fois, avec les drapeaux cumulés, si au moins une
+     * notification a eu lieu pendant la transaction.
+     *
+     * \sa beginNotifications().
+     */
+    void commitNotifications();
+
+    /*!
+     * \brief Abandonne une transaction de notifications.
+     *
+     * La transaction est fermée sans notifier. À la fermeture de la plus
+     * externe, les drapeaux cumulés sont oubliés.
+     *
+     * \sa beginNotifications().
+     */
+    void abortNotifications();
+
+    /*!
+     * \brief Transaction de notifications ouverte le temps d'une portée.
+     *
+     * La transaction n'est validée que par commit(). Si la portée est
+     * quittée sans l'avoir validée, par exemple par une exception, elle est
+     * abandonnée : les observateurs ne sont pas notifiés d'un état à moitié
+     * modifié, et aucun observateur n'est appelé depuis le destructeur.
+     */
+    class Batch
+    {
+        Subject & subject_;
+
+        bool isOpen_ { true };
+
+      public:
+
+        /*!
+         * \brief Ouvre une transaction sur le sujet donné.
+         *
+         * \param subject le sujet dont les notifications sont regroupées.
+         */
+        explicit Batch(Subject & subject) : subject_ { subject }
+        {
+            subject_.beginNotifications();
+        }
+
+        Batch(const Batch &) = delete;
+
+        Batch & operator=(const Batch &) = delete;
+
+        /*!
+         * \brief Valide la transaction et notifie les observateurs si c'est
+         * la plus externe.
+         */
+        void commit()
+        {
+            isOpen_ = false;
+            subject_.commitNotifications();
+        }
+
+        /*!
+         * \brief Abandonne la transaction si elle n'a pas été validée.
+         */
+        ~Batch()
+        {
+            if (isOpen_)
+            {
+                subject_.abortNotifications();
+            }
+        }
+    };
+
+  protected:
+
+    /*!
+     * \brief Constructeur protégé pour éviter l'instanciation
+     *        hors héritage.
+     */
+    Subject() = default;
+
+    /*!
+     * \brief Méthode qui se charge de prévenir les observateurs d'un
+     * changement d'état du sujet d'observation, en invoquant leur
+     * méthode Observer::update().
+     *
+     * Pendant une transaction, la notification est différée jusqu'à sa
+     * fermeture.
+     *
+     * \param changes les drapeaux de ce qui a changé.
+     * \sa Observer::update(const Subject *, Changes).
+     */
+    virtual void notifyObservers(Changes changes = ALL_CHANGES) const final;
+
+  protected:
+
+    /*!
+     * \brief L'ensemble d'observateurs enregistrés.
+     */
+    std::set<Observer *> observers_ { };
+
+  private:
+
+    /*!
+     * \brief Le nombre de transactions ouvertes.
+     */
+    unsigned batchDepth_ { 0 };
+
+    /*!
+     * \brief Les drapeaux cumulés pendant la transaction en cours.
+     */
+    mutable Changes pendingChanges_ { 0 };
+};
+
+} // namespace nvs
+
+#endif
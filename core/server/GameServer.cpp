@@ -0,0 +1,356 @@
+#include "GameServer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "Game.h"
+#include "Session.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace labyrinth { namespace server {
+
+constexpr std::size_t GameServer::MAX_LINE_LENGTH;
+constexpr std::size_t GameServer::MAX_NB_OF_QUEUED_LINES;
+
+/**
+ * @brief Is a client of the server and the session it plays.
+ */
+struct GameServer::Connection
+{
+
+    explicit Connection(int socket)
+        : socket{socket}
+    {}
+
+    int socket;
+
+    /**
+     * @brief Are the received characters that do not end a line yet. Only the
+     * thread running the server uses them.
+     */
+    std::string input;
+
+    /**
+     * @brief Is the session of the client. Only the task serving the
+     * connection uses it.
+     */
+    std::unique_ptr<Session> session;
+
+    /**
+     * @brief Guards the members below, shared by the thread running the
+     * server and the task serving the connection.
+     */
+    std::mutex mutex;
+
+    std::deque<std::string> lines;
+
+    std::string output;
+
+    bool isBusy = false;
+
+    bool isStarted = false;
+
+    bool isClosing = false;
+
+};
+
+/**
+ * @brief Makes the given file descriptor return instead of blocking.
+ */
+static bool setNonBlocking(int descriptor)
+{
+    int flags = fcntl(descriptor, F_GETFL, 0);
+    return flags >= 0 && fcntl(descriptor, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Gets the message of the last system error, prefixed by the given
+ * context.
+ */
+static std::string getSystemError(const std::string &context)
+{
+    return context + ": " + std::strerror(errno);
+}
+
+GameServer::GameServer(unsigned short port, unsigned nbOfThreads,
+                       unsigned nbOfPlayers, bool isSimplified)
+    : nbOfPlayers_{nbOfPlayers},
+      isSimplified_{isSimplified},
+      listener_{-1},
+      port_{port},
+      wakeUp_{-1, -1},
+      isStopping_{false},
+      nextSeed_{std::random_device{}()},
+      nbOfSessions_{0},
+      connections_{},
+      pool_{nbOfThreads + 1}
+{
+    if (nbOfThreads == 0) {
+        throw std::invalid_argument("The server needs at least one thread.");
+    }
+    if (nbOfPlayers < model::Game::MIN_NB_OF_PLAYERS
+            || model::Game::MAX_NB_OF_PLAYERS < nbOfPlayers) {
+        throw std::invalid_argument(std::to_string(nbOfPlayers)
+                                    + " is not a valid number of player!");
+    }
+    std::string error;
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    int reuse = 1;
+    if (pipe(wakeUp_) != 0 || !setNonBlocking(wakeUp_[0])
+            || !setNonBlocking(wakeUp_[1])) {
+        error = getSystemError("Cannot create the wake up pipe");
+    } else if ((listener_ = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        error = getSystemError("Cannot create the socket");
+    } else if (setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &reuse,
+                          sizeof(reuse)) != 0
+               || bind(listener_, reinterpret_cast<sockaddr *>(&address),
+                       sizeof(address)) != 0) {
+        error = getSystemError("Cannot bind port " + std::to_string(port));
+    } else if (listen(listener_, SOMAXCONN) != 0 || !setNonBlocking(listener_)
+               || getsockname(listener_, reinterpret_cast<sockaddr *>(&address),
+                              &length) != 0) {
+        error = getSystemError("Cannot listen to port " + std::to_string(port));
+    }
+    if (!error.empty()) {
+        for (int descriptor : {listener_, wakeUp_[0], wakeUp_[1]}) {
+            if (descriptor >= 0) ::close(descriptor);
+        }
+        throw std::runtime_error(error);
+    }
+    port_ = ntohs(address.sin_port);
+}
+
+GameServer::~GameServer()
+{
+    try {
+        pool_.wait(tasks_);
+    } catch (const std::exception &) {
+        // The tasks report their errors to their clients.
+    }
+    for (auto &entry : connections_) {
+        ::close(entry.first);
+    }
+    ::close(listener_);
+    ::close(wakeUp_[0]);
+    ::close(wakeUp_[1]);
+}
+
+void GameServer::wakeUp()
+{
+    char signal = 0;
+    if (write(wakeUp_[1], &signal, 1) < 0) {
+        // The pipe is full: the server is already to be woken up.
+    }
+}
+
+void GameServer::stop()
+{
+    isStopping_ = true;
+    wakeUp();
+}
+
+void GameServer::accept()
+{
+    int socket;
+    while ((socket = ::accept(listener_, nullptr, nullptr)) >= 0) {
+        if (!setNonBlocking(socket)) {
+            ::close(socket);
+            continue;
+        }
+        std::shared_ptr<Connection> connection = std::make_shared<Connection>(socket);
+        connections_[socket] = connection;
+        schedule(connection);
+    }
+}
+
+void GameServer::close(int socket)
+{
+    connections_.erase(socket);
+    ::close(socket);
+}
+
+void GameServer::receive(const std::shared_ptr<Connection> &connection)
+{
+    char buffer[4096];
+    ssize_t size = ::recv(connection->socket, buffer, sizeof(buffer), 0);
+    if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+        return;
+    }
+    if (size <= 0) {
+        close(connection->socket);
+        return;
+    }
+    std::string &input = connection->input;
+    input.append(buffer, static_cast<std::size_t>(size));
+    {
+        std::lock_guard<std::mutex> lock{connection->mutex};
+        std::string::size_type start = 0;
+        std::string::size_type end;
+        while ((end = input.find('\n', start)) != std::string::npos) {
+            connection->lines.push_back(input.substr(start, end - start));
+            start = end + 1;
+        }
+        input.erase(0, start);
+    }
+    if (input.size() > MAX_LINE_LENGTH) {
+        close(connection->socket);
+        return;
+    }
+    schedule(connection);
+}
+
+void GameServer::send(const std::shared_ptr<Connection> &connection)
+{
+    bool isDone;
+    {
+        std::lock_guard<std::mutex> lock{connection->mutex};
+        std::string &output = connection->output;
+        while (!output.empty()) {
+            ssize_t size = ::send(connection->socket, output.data(), output.size(),
+                                  MSG_NOSIGNAL);
+            if (size < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                connection->isClosing = true;
+                output.clear();
+                break;
+            }
+            output.erase(0, static_cast<std::size_t>(size));
+        }
+        isDone = output.empty() && connection->isClosing && !connection->isBusy;
+    }
+    if (isDone) close(connection->socket);
+}
+
+void GameServer::schedule(const std::shared_ptr<Connection> &connection)
+{
+    {
+        std::lock_guard<std::mutex> lock{connection->mutex};
+        if (connection->isBusy || connection->isClosing
+                || (connection->isStarted && connection->lines.empty())) {
+            return;
+        }
+        connection->isBusy = true;
+    }
+    pool_.submit(tasks_, [this, connection] { serve(connection); });
+}
+
+void GameServer::serve(const std::shared_ptr<Connection> &connection)
+{
+    Connection &client = *connection;
+    try {
+        if (!client.session) {
+            client.session.reset(new Session{nbOfPlayers_, isSimplified_, nextSeed_++});
+            ++nbOfSessions_;
+            std::string text = client.session->start();
+            std::lock_guard<std::mutex> lock{client.mutex};
+            client.output += text;
+            client.isStarted = true;
+        }
+        for (;;) {
+            std::string line;
+            {
+                std::lock_guard<std::mutex> lock{client.mutex};
+                if (client.lines.empty() || client.isClosing) {
+                    client.isBusy = false;
+                    break;
+                }
+                line = std::move(client.lines.front());
+                client.lines.pop_front();
+            }
+            std::string reply = client.session->execute(line);
+            std::lock_guard<std::mutex> lock{client.mutex};
+            client.output += reply;
+            if (client.session->isOver()) {
+                client.isClosing = true;
+                client.lines.clear();
+            }
+        }
+    } catch (const std::exception &e) {
+        std::lock_guard<std::mutex> lock{client.mutex};
+        client.output += std::string{e.what()} + "\n";
+        client.isClosing = true;
+        client.isBusy = false;
+    }
+    wakeUp();
+}
+
+void GameServer::run()
+{
+    std::vector<pollfd> descriptors;
+    std::vector<std::shared_ptr<Connection>> polled;
+    std::vector<int> finished;
+    while (!isStopping_) {
+        descriptors.clear();
+        polled.clear();
+        finished.clear();
+        descriptors.push_back(pollfd{wakeUp_[0], POLLIN, 0});
+        descriptors.push_back(pollfd{listener_, POLLIN, 0});
+        for (auto &entry : connections_) {
+            Connection &connection = *entry.second;
+            short events = 0;
+            {
+                std::lock_guard<std::mutex> lock{connection.mutex};
+                if (!connection.isClosing
+                        && connection.lines.size() < MAX_NB_OF_QUEUED_LINES) {
+                    events |= POLLIN;
+                }
+                if (!connection.output.empty()) events |= POLLOUT;
+                else if (connection.isClosing && !connection.isBusy) {
+                    finished.push_back(entry.first);
+                    continue;
+                }
+            }
+            descriptors.push_back(pollfd{entry.first, events, 0});
+            polled.push_back(entry.second);
+        }
+        for (int socket : finished) {
+            close(socket);
+        }
+        if (poll(descriptors.data(), descriptors.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(getSystemError("Cannot wait for the sockets"));
+        }
+        if (descriptors[0].revents & POLLIN) {
+            char signals[64];
+            while (read(wakeUp_[0], signals, sizeof(signals)) > 0) {}
+        }
+        if (descriptors[1].revents & POLLIN) {
+            accept();
+        }
+        for (std::size_t index = 2; index < descriptors.size(); ++index) {
+            const pollfd &descriptor = descriptors[index];
+            const std::shared_ptr<Connection> &connection = polled[index - 2];
+            if (descriptor.revents & (POLLIN | POLLHUP | POLLERR)) {
+                if (descriptor.events & POLLIN) receive(connection);
+                else close(descriptor.fd);
+            }
+            if (descriptor.revents & POLLOUT && connections_.count(descriptor.fd)) {
+                send(connection);
+            }
+        }
+    }
+    pool_.wait(tasks_);
+}
+
+}}
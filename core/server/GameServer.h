@@ -0,0 +1,151 @@
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "WorkStealingPool.h"
+
+namespace labyrinth { namespace server {
+
+/**
+ * @brief Hosts many games at once, each played by a client of a local TCP
+ * socket.
+ *
+ * Every connection plays its own game through a Session: the client sends the
+ * commands of the console, one per line, and receives what the console would
+ * have printed, ended by the prompt of the next command. The connection is
+ * closed once the game is over or the client exits.
+ *
+ * A single thread waits for the sockets with poll. The commands are executed
+ * by a fixed number of worker threads, at most one command of a session at a
+ * time, so the number of threads does not grow with the number of sessions.
+ */
+class GameServer
+{
+
+public:
+
+    /**
+     * @brief Is the maximum length of a command line. The client sending a
+     * longer line is disconnected.
+     */
+    static constexpr std::size_t MAX_LINE_LENGTH = 1024;
+
+    /**
+     * @brief Is the number of command lines a client can have waiting for its
+     * session, give or take the lines of a single read. The socket of the
+     * client is not read while its queue is full,
+     * so a client sending lines faster than they are executed is slowed down
+     * instead of growing the memory of the server.
+     */
+    static constexpr std::size_t MAX_NB_OF_QUEUED_LINES = 64;
+
+private:
+
+    struct Connection;
+
+    unsigned nbOfPlayers_;
+
+    bool isSimplified_;
+
+    int listener_;
+
+    unsigned short port_;
+
+    /**
+     * @brief Is the pipe written to wake up the thread waiting with poll.
+     */
+    int wakeUp_[2];
+
+    std::atomic<bool> isStopping_;
+
+    std::atomic<unsigned> nextSeed_;
+
+    std::atomic<unsigned> nbOfSessions_;
+
+    /**
+     * @brief Are the open connections, by socket. Only the thread running the
+     * server uses this map.
+     */
+    std::map<int, std::shared_ptr<Connection>> connections_;
+
+    bot::WorkStealingPool pool_;
+
+    bot::WorkStealingPool::TaskGroup tasks_;
+
+    void wakeUp();
+
+    void accept();
+
+    void receive(const std::shared_ptr<Connection> &connection);
+
+    void send(const std::shared_ptr<Connection> &connection);
+
+    void close(int socket);
+
+    void schedule(const std::shared_ptr<Connection> &connection);
+
+    void serve(const std::shared_ptr<Connection> &connection);
+
+public:
+
+    /**
+     * @brief Constructs a server listening on the loopback interface.
+     *
+     * @param port is the port to listen to, 0 to let the system choose one.
+     * @param nbOfThreads is the number of threads executing the commands.
+     * @param nbOfPlayers is the number of players of the hosted games.
+     * @param isSimplified tells if the hosted games are simplified.
+     * @throws std::invalid_argument if there is no thread or the number of
+     * players is not supported.
+     * @throws std::runtime_error if the socket cannot be opened.
+     */
+    GameServer(unsigned short port, unsigned nbOfThreads, unsigned nbOfPlayers,
+               bool isSimplified);
+
+    GameServer(const GameServer &) = delete;
+
+    GameServer &operator=(const GameServer &) = delete;
+
+    /**
+     * @brief Closes every connection and the listening socket.
+     */
+    ~GameServer();
+
+    /**
+     * @brief Gets the port this server listens to.
+     *
+     * @return the port of this server.
+     */
+    unsigned short getPort() const { return port_; }
+
+    /**
+     * @brief Gets the number of sessions started since the creation of this
+     * server.
+     *
+     * @return the number of started sessions.
+     */
+    unsigned getNbOfSessions() const { return nbOfSessions_; }
+
+    /**
+     * @brief Accepts clients and serves their commands until stop is called.
+     * The commands being executed are finished before returning.
+     *
+     * @throws std::runtime_error if waiting for the sockets fails.
+     */
+    void run();
+
+    /**
+     * @brief Asks the thread running this server to return. Can be called from
+     * any thread.
+     */
+    void stop();
+
+};
+
+}}
+
+#endif // GAMESERVER_H
@@ -0,0 +1,105 @@
+#include "Session.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "CommandType.h"
+#include "MazeBitboard.h"
+
+namespace labyrinth { namespace server {
+
+/**
+ * @brief Splits the given line on spaces, ignoring the empty words and the
+ * carriage return sent by some clients.
+ */
+static std::vector<std::string> tokenize(const std::string &line)
+{
+    std::vector<std::string> tokens;
+    std::string::size_type start = 0;
+    while (start < line.size()) {
+        std::string::size_type end = line.find_first_of(" \t\r", start);
+        if (end == std::string::npos) end = line.size();
+        if (end > start) tokens.push_back(line.substr(start, end - start));
+        start = end + 1;
+    }
+    return tokens;
+}
+
+/**
+ * @brief Checks the coordinates given to the commands taking a position, so
+ * that a client never reaches the model with a cell outside of the maze.
+ *
+ * @throws std::invalid_argument if a coordinate is not a number smaller than
+ * the size of the maze.
+ */
+static void requireValidCoordinates(const std::vector<std::string> &argv)
+{
+    for (std::size_t index = 1; index < argv.size() && index < 3; ++index) {
+        const std::string &word = argv[index];
+        if (word.empty() || word.size() > 2
+                || word.find_first_not_of("0123456789") != std::string::npos
+                || std::stoul(word) >= model::MazeBitboard::SIZE) {
+            throw std::invalid_argument("Invalid coordinate! " + word + " was entered but a"
+                                        " coordinate should be between 0 and "
+                                        + std::to_string(model::MazeBitboard::SIZE - 1) + ".");
+        }
+    }
+}
+
+Session::Session(unsigned nbOfPlayers, bool isSimplified, unsigned seed)
+    : game_{nbOfPlayers, isSimplified, seed},
+      out_{},
+      view_{&game_, out_},
+      factory_{view_, &game_},
+      isOver_{false}
+{}
+
+std::string Session::takeOutput()
+{
+    std::string output = out_.str();
+    out_.str("");
+    return output;
+}
+
+std::string Session::start()
+{
+    view_.printMaze();
+    view_.printPrompt();
+    return takeOutput();
+}
+
+std::string Session::execute(const std::string &line)
+{
+    if (isOver_) {
+        throw std::logic_error("The session is over.");
+    }
+    std::vector<std::string> argv = tokenize(line);
+    try {
+        if (!argv.empty()) {
+            controller::CommandType type = controller::fromString(argv.at(0));
+            if (type == controller::EXIT) {
+                isOver_ = true;
+                view_.print("Bye!");
+                return takeOutput();
+            }
+            if (type == controller::INSERT || type == controller::MOVE) {
+                requireValidCoordinates(argv);
+            }
+            std::unique_ptr<controller::Command> command{factory_.getCommand(type)};
+            command->setArguments(argv);
+            command->execute();
+        }
+    } catch (const std::exception &e) {
+        view_.print(e.what());
+    }
+    if (game_.isOver()) {
+        isOver_ = true;
+        view_.printWinner();
+    } else {
+        view_.printPrompt();
+    }
+    return takeOutput();
+}
+
+}}
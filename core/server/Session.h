@@ -0,0 +1,93 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <sstream>
+#include <string>
+
+#include "Game.h"
+#include "View.h"
+#include "CommandFactory.h"
+
+namespace labyrinth { namespace server {
+
+/**
+ * @brief Represents a game played through text commands, as in the console.
+ *
+ * Each line given to a session is executed by the command of the console it
+ * names, and what the console would have printed is given back instead.
+ */
+class Session
+{
+
+    model::Game game_;
+
+    std::ostringstream out_;
+
+    view::View view_;
+
+    controller::CommandFactory factory_;
+
+    /**
+     * @brief Tells if the game is over or has been left.
+     */
+    bool isOver_;
+
+    /**
+     * @brief Gets and clears what has been printed so far.
+     */
+    std::string takeOutput();
+
+public:
+
+    /**
+     * @brief Constructs a session playing a new game.
+     *
+     * @param nbOfPlayers is the number of players of the game.
+     * @param isSimplified tells if the game is simplified.
+     * @param seed is the seed of the random engine of the game.
+     * @throws std::logic_error if the number of players is not supported.
+     */
+    Session(unsigned nbOfPlayers, bool isSimplified, unsigned seed);
+
+    Session(const Session &) = delete;
+
+    Session &operator=(const Session &) = delete;
+
+    /**
+     * @brief Gets the text that opens the session: the maze and the prompt of
+     * the first player.
+     *
+     * @return the text to show before the first command.
+     */
+    std::string start();
+
+    /**
+     * @brief Executes the given command line. The errors of the command are
+     * reported in the returned text, like in the console.
+     *
+     * @param line is the command line, like "insert 0 1".
+     * @return what the command printed, followed by the prompt of the next
+     * command, or by the winner once the game is over.
+     */
+    std::string execute(const std::string &line);
+
+    /**
+     * @brief Tells if this session is over, either because the game is over
+     * or because the players exited it.
+     *
+     * @return true if no more command can be executed.
+     */
+    bool isOver() const { return isOver_; }
+
+    /**
+     * @brief Gets the game played in this session.
+     *
+     * @return the game of this session.
+     */
+    const model::Game &getGame() const { return game_; }
+
+};
+
+}}
+
+#endif // SESSION_H
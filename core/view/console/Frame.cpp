@@ -0,0 +1,105 @@
+#include "Frame.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace labyrinth { namespace view {
+
+/**
+ * @brief Is the number of unchanged characters under which two changes of a
+ * row are redrawn together, the cursor move costing about as much.
+ */
+static constexpr unsigned MAX_GAP = 8;
+
+/**
+ * @brief Appends the ANSI sequence moving the cursor to the given place.
+ */
+static void appendCursorMove(std::string &text, unsigned row, unsigned column)
+{
+    text += "\x1b[";
+    text += std::to_string(row);
+    text += ';';
+    text += std::to_string(column);
+    text += 'H';
+}
+
+Frame::Frame(unsigned nbOfRows, unsigned width)
+    : nbOfRows_{nbOfRows},
+      width_{width},
+      chars_(nbOfRows * width, ' '),
+      lengths_(nbOfRows, 0)
+{}
+
+void Frame::clear()
+{
+    std::memset(chars_.data(), ' ', chars_.size());
+    std::memset(lengths_.data(), 0, lengths_.size() * sizeof(unsigned));
+}
+
+void Frame::put(unsigned row, unsigned column, char c)
+{
+    if (row >= nbOfRows_ || column >= width_) {
+        throw std::out_of_range("The character is outside of the frame.");
+    }
+    chars_[row * width_ + column] = c;
+    if (lengths_[row] <= column) lengths_[row] = column + 1;
+}
+
+void Frame::put(unsigned row, unsigned column, const char *text)
+{
+    std::size_t length = std::strlen(text);
+    if (row >= nbOfRows_ || column > width_ || length > width_ - column) {
+        throw std::out_of_range("The text does not fit in the frame.");
+    }
+    std::memcpy(&chars_[row * width_ + column], text, length);
+    if (lengths_[row] < column + length) lengths_[row] = column + length;
+}
+
+void Frame::appendTo(std::string &text) const
+{
+    for (unsigned row = 0; row < nbOfRows_; ++row) {
+        text.append(&chars_[row * width_], lengths_[row]);
+        text += '\n';
+    }
+}
+
+void Frame::appendChangesTo(const Frame &previous, unsigned top,
+                            std::string &text) const
+{
+    if (previous.nbOfRows_ != nbOfRows_ || previous.width_ != width_) {
+        throw std::invalid_argument("The frames have not the same size.");
+    }
+    for (unsigned row = 0; row < nbOfRows_; ++row) {
+        const char *current = &chars_[row * width_];
+        const char *before = &previous.chars_[row * width_];
+        unsigned length = lengths_[row];
+        unsigned column = 0;
+        while (column < length) {
+            if (current[column] == before[column]
+                    && column < previous.lengths_[row]) {
+                ++column;
+                continue;
+            }
+            unsigned end = column + 1;
+            unsigned gap = 0;
+            for (unsigned next = end; next < length && gap < MAX_GAP; ++next) {
+                if (current[next] != before[next]
+                        || next >= previous.lengths_[row]) {
+                    end = next + 1;
+                    gap = 0;
+                } else {
+                    ++gap;
+                }
+            }
+            appendCursorMove(text, top + row, column + 1);
+            text.append(current + column, end - column);
+            column = end;
+        }
+        if (length < previous.lengths_[row]) {
+            appendCursorMove(text, top + row, length + 1);
+            text += "\x1b[K";
+        }
+    }
+}
+
+}}
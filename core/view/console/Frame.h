@@ -0,0 +1,127 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <string>
+#include <vector>
+
+namespace labyrinth { namespace view {
+
+/**
+ * @brief Represents a rectangle of characters drawn on the console.
+ *
+ * The characters are kept in a single buffer allocated at construction, so a
+ * frame is redrawn again and again without allocation. Each row remembers how
+ * far it has been drawn, so the trailing part of a row that was never drawn
+ * is not printed.
+ */
+class Frame
+{
+
+    unsigned nbOfRows_;
+    unsigned width_;
+
+    /**
+     * @brief Are the characters of the frame, row after row.
+     */
+    std::vector<char> chars_;
+
+    /**
+     * @brief Is the number of characters drawn on each row.
+     */
+    std::vector<unsigned> lengths_;
+
+public:
+
+    /**
+     * @brief Constructs an empty frame.
+     *
+     * @param nbOfRows is the number of rows of the frame.
+     * @param width is the maximum number of characters of a row.
+     */
+    Frame(unsigned nbOfRows, unsigned width);
+
+    /**
+     * @brief Gets the number of rows of this frame.
+     *
+     * @return the number of rows of this frame.
+     */
+    unsigned getNbOfRows() const { return nbOfRows_; }
+
+    /**
+     * @brief Gets the maximum number of characters of a row of this frame.
+     *
+     * @return the width of this frame.
+     */
+    unsigned getWidth() const { return width_; }
+
+    /**
+     * @brief Erases every row of this frame.
+     */
+    void clear();
+
+    /**
+     * @brief Draws the given character.
+     *
+     * @param row is the row to draw on.
+     * @param column is the column of the character.
+     * @param c is the character to draw.
+     * @throws std::out_of_range if the character is outside of the frame.
+     */
+    void put(unsigned row, unsigned column, char c);
+
+    /**
+     * @brief Draws the given text, from left to right.
+     *
+     * @param row is the row to draw on.
+     * @param column is the column of the first character of the text.
+     * @param text is the text to draw.
+     * @throws std::out_of_range if the text does not fit in the frame.
+     */
+    void put(unsigned row, unsigned column, const char *text);
+
+    /**
+     * @brief Gets the character at the given place. The place that has not
+     * been drawn is a space.
+     *
+     * @param row is the row of the character.
+     * @param column is the column of the character.
+     * @return the character at the given place.
+     */
+    char getAt(unsigned row, unsigned column) const {
+        return chars_[row * width_ + column];
+    }
+
+    /**
+     * @brief Gets the number of characters drawn on the given row.
+     *
+     * @param row is the row to get the length of.
+     * @return the column following the last drawn character of the row.
+     */
+    unsigned getLength(unsigned row) const { return lengths_[row]; }
+
+    /**
+     * @brief Appends every row of this frame to the given text, each followed
+     * by a new line.
+     *
+     * @param text is the text to append to.
+     */
+    void appendTo(std::string &text) const;
+
+    /**
+     * @brief Appends to the given text the ANSI sequences redrawing what
+     * changed since the given frame, when the previous frame is displayed from
+     * the given console row.
+     *
+     * @param previous is the frame currently on the console.
+     * @param top is the console row of the first row of the frame, from 1.
+     * @param text is the text to append to.
+     * @throws std::invalid_argument if the frames have not the same size.
+     */
+    void appendChangesTo(const Frame &previous, unsigned top,
+                         std::string &text) const;
+
+};
+
+}}
+
+#endif // FRAME_H
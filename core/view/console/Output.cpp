@@ -6,15 +6,67 @@
 
 #include <iomanip>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace labyrinth::view;
 using namespace labyrinth::model;
 
-static std::string VOID = "   ";
-static std::string HWALL = "---";
-static std::string VWALL = "|";
-static std::string CORNER = "+";
+static const char *VOID = "   ";
+static const char *HWALL = "---";
+static const char VWALL = '|';
+static const char CORNER = '+';
+
+/**
+ * @brief Draws the 3 rows of the given maze card, from the given place.
+ */
+static void drawMazeCard(Frame &frame, unsigned row, unsigned column,
+                         const MazeCard &card, const char *icon = VOID)
+{
+    frame.put(row, column, CORNER);
+    frame.put(row, column + 1, card.isGoing(UP) ? VOID : HWALL);
+    frame.put(row, column + 4, CORNER);
+    frame.put(row + 1, column, card.isGoing(LEFT) ? ' ' : VWALL);
+    frame.put(row + 1, column + 1, icon);
+    frame.put(row + 1, column + 4, card.isGoing(RIGHT) ? ' ' : VWALL);
+    frame.put(row + 2, column, CORNER);
+    frame.put(row + 2, column + 1, card.isGoing(DOWN) ? VOID : HWALL);
+    frame.put(row + 2, column + 4, CORNER);
+}
+
+/**
+ * @brief Gets the icons of the players of the given mask, centered on 3
+ * characters.
+ */
+static void getPlayersIcons(std::uint8_t players, char icons[4])
+{
+    static const std::string colorIcons = toIcon(Player::RED)
+            + toIcon(Player::BLUE) + toIcon(Player::YELLOW)
+            + toIcon(Player::GREEN);
+    char found[4];
+    unsigned count = 0;
+    for (Player::Color color = Player::RED; color <= Player::GREEN; ++color) {
+        if ((players >> color) & 1) found[count++] = colorIcons[color];
+    }
+    icons[0] = icons[1] = icons[2] = ' ';
+    icons[3] = '\0';
+    switch (count) {
+    case 1:
+        icons[1] = found[0];
+        break;
+    case 2:
+        icons[0] = found[0];
+        icons[2] = found[1];
+        break;
+    case 3:
+        icons[0] = found[0];
+        icons[1] = found[1];
+        icons[2] = found[2];
+        break;
+    default:
+        icons[1] = 'X';
+    }
+}
 
 void Output::print(std::string msg) const { out_ << msg << std::endl; }
 
@@ -52,99 +104,69 @@ void Output::printHelp() const
     out_ << setw(30) <<"exit" << setw(50)<< "exits the game." << std::endl;
 }
 
-void Output::printUpperInsertionIcons() const
-{
-    out_ << "    ";
-    for (unsigned column = 1; column <= Maze::SIZE; ++column)
-        out_ << "  " << (column % 2 == 0 ? "v" : " ") << "  ";
-    out_ << std::endl;
-}
-
-void Output::printDownInsertionIcons() const
+void Output::write(const std::string &text) const
 {
-    out_ << "    ";
-    for (unsigned column = 1; column <= Maze::SIZE; ++column)
-        out_ << "  " << (column % 2 == 0 ? "^" : " ") << "  ";
-    out_ << std::endl;
+    out_.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out_.flush();
 }
 
-void Output::printColumnCoordinate() const
+void Output::drawMaze(Frame &frame) const
 {
-    out_ << "    ";
-    for (unsigned column = 0; column < Maze::SIZE; ++column)
-        out_ << "  " << column << "  ";
-    out_ << std::endl;
-}
-
-void Output::printMazeCardPart(const MazeCard &card, unsigned part,
-                               std::string icon = VOID) const
-{
-    if (part == 0) {
-        out_ << CORNER << (card.isGoing(UP) ? VOID : HWALL) << CORNER;
-    } else if (part == 1) {
-        out_ << (card.isGoing(LEFT) ? " " : VWALL) << icon;
-        out_ << (card.isGoing(RIGHT) ? " " : VWALL);
-    } else {
-        out_ << CORNER << (card.isGoing(DOWN) ? VOID : HWALL) << CORNER;
-    }
-}
-
-static string getPlayersIcons(vector<Player> players) {
-    stringstream icons;
-    switch (players.size()) {
-    case 1:
-        icons << " " << toIcon(players.at(0).getColor()) << " ";
-        break;
-    case 2:
-        icons << toIcon(players.at(0).getColor()) << " ";
-        icons << toIcon(players.at(1).getColor());
-        break;
-    case 3:
-        icons << toIcon(players.at(0).getColor());
-        icons << toIcon(players.at(1).getColor());
-        icons << toIcon(players.at(1).getColor());
-        break;
-    default:
-        icons << " X ";
+    const unsigned left = 4;
+    for (unsigned column = 0; column < Maze::SIZE; ++column) {
+        unsigned x = left + column * 5;
+        frame.put(0, x, column % 2 != 0 ? "  v  " : "     ");
+        frame.put(1, x, "     ");
+        frame.put(1, x + 2, std::to_string(column).c_str());
+        frame.put(3 * Maze::SIZE + 2, x, column % 2 != 0 ? "  ^  " : "     ");
     }
-    return icons.str();
-}
-
-void Output::printMazeCardPartsRow(unsigned mazeRow, unsigned part) const
-{
-    for (unsigned mazeColumn = 0; mazeColumn < Maze::SIZE; ++mazeColumn) {
-        MazePosition currentPosition{mazeRow, mazeColumn};
-        MazeCard card = game_->getMaze().getCardAt(currentPosition);
-        if (game_->isAPlayerAt(currentPosition)) {
-            vector<Player> players = game_->getPlayersAt(currentPosition);
-            printMazeCardPart(card, part, getPlayersIcons(players));
-        } else {
-            printMazeCardPart(card, part);
+    frame.put(0, 0, "    ");
+    frame.put(1, 0, "    ");
+    frame.put(3 * Maze::SIZE + 2, 0, "    ");
+    const Maze &maze = game_->getMaze();
+    const Occupancy &occupancy = game_->getOccupancy();
+    char icons[4];
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        unsigned y = 2 + row * 3;
+        frame.put(y, 0, "    ");
+        frame.put(y + 1, 0, row % 2 != 0 ? ">   " : "    ");
+        frame.put(y + 1, 2, std::to_string(row).c_str());
+        frame.put(y + 2, 0, "    ");
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            std::uint8_t players = occupancy.getPlayersAt(position);
+            if (players != 0) {
+                getPlayersIcons(players, icons);
+                drawMazeCard(frame, y, left + column * 5, maze.getCardAt(position), icons);
+            } else {
+                drawMazeCard(frame, y, left + column * 5, maze.getCardAt(position));
+            }
         }
+        if (row % 2 != 0) frame.put(y + 1, left + Maze::SIZE * 5, " <");
     }
+    frame.put(3 * Maze::SIZE + 4, 0, "Current mazecard...");
+    drawMazeCard(frame, 3 * Maze::SIZE + 5, 0, game_->getCurrentMazeCard());
 }
 
 void Output::printMaze() const
 {
-    printUpperInsertionIcons();
-    printColumnCoordinate();
-    for (unsigned row = 0; row < Maze::SIZE; ++row) {
-        for (unsigned part = 0; part < 3; ++part) {
-            if (part == 1) {
-                out_ << (row % 2 != 0 ? "> " : "  ");
-                out_  << row << " ";
-            } else {
-                out_ << "    ";
-            }
-            printMazeCardPartsRow(row, part);
-            if (part == 1) out_ << (row % 2 != 0 ? " <\n" : "\n");
-            else out_ << "\n";
+    frame_.clear();
+    drawMaze(frame_);
+    text_.clear();
+    if (!isAnsi_) {
+        frame_.appendTo(text_);
+    } else {
+        if (hasLastFrame_) {
+            frame_.appendChangesTo(lastFrame_, 1, text_);
+            text_ += "\x1b[" + std::to_string(FRAME_ROWS + 1) + ";1H\x1b[J";
+        } else {
+            text_ += "\x1b[H\x1b[2J";
+            frame_.appendTo(text_);
         }
+        std::swap(frame_, lastFrame_);
+        hasLastFrame_ = true;
     }
-    printDownInsertionIcons();
-    out_ << "\nCurrent mazecard...\n";
-    printCurrentMazeCard();
-    out_ << "\n";
+    write(text_);
 }
 
 void Output::printPlayers() const
@@ -174,15 +196,20 @@ void Output::printMazeObjectives() const
 void Output::printCurrentPlayerObjective() const
 {
     Object o = game_->getCurrentPlayer().getCurrentObjective().getObject();
-    print(toString(o) + " at " + toString(game_->getObjectivePosition(o)));
+    if (game_->getMaze().isInside(o)) {
+        print(toString(o) + " at " + toString(game_->getObjectivePosition(o)));
+    } else {
+        print(toString(o) + " on the current maze card");
+    }
 }
 
 void Output::printCurrentMazeCard() const
 {
-    for (unsigned part = 0; part < 3; ++part) {
-        printMazeCardPart(game_->getCurrentMazeCard(), part);
-        out_ << "\n";
-    }
+    Frame frame{3, 5};
+    drawMazeCard(frame, 0, 0, game_->getCurrentMazeCard());
+    text_.clear();
+    frame.appendTo(text_);
+    write(text_);
 }
 
 void Output::printWinner() const
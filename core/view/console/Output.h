@@ -2,31 +2,51 @@
 #define OUTPUT_H
 
 #include <iostream>
+#include <string>
 
+#include "Frame.h"
 #include "Game.h"
 
 namespace labyrinth { namespace view {
 
 /**
  * @brief Manages all the output of the view.
+ *
+ * The maze is drawn in a frame and written to the output stream at once. In
+ * ANSI mode, the maze stays at the top of the console and only the characters
+ * that changed since the last printed maze are redrawn.
  */
 class Output
 {
 
-    const model::Game *game_;
-    std::ostream &out_;
+    /**
+     * @brief Is the number of rows of the printed maze, current maze card
+     * included.
+     */
+    static constexpr unsigned FRAME_ROWS = 3 * model::Maze::SIZE + 9;
 
-    void printUpperInsertionIcons() const;
+    /**
+     * @brief Is the maximum number of characters of a row of the printed maze.
+     */
+    static constexpr unsigned FRAME_WIDTH = 5 * model::Maze::SIZE + 6;
 
-    void printDownInsertionIcons() const;
+    const model::Game *game_;
+    std::ostream &out_;
+    bool isAnsi_;
 
-    void printColumnCoordinate() const;
+    mutable Frame frame_;
+    mutable Frame lastFrame_;
+    mutable bool hasLastFrame_;
 
-    void printMazeCardPart(const model::MazeCard &, unsigned, std::string) const;
+    /**
+     * @brief Is the text written to the output stream, kept to reuse its
+     * memory from one print to the next.
+     */
+    mutable std::string text_;
 
-    std::string getCenterString() const;
+    void drawMaze(Frame &frame) const;
 
-    void printMazeCardPartsRow(unsigned mazeRow, unsigned part) const;
+    void write(const std::string &text) const;
 
 public:
 
@@ -35,9 +55,12 @@ public:
      *
      * @param game is a pointer to the game to make output for.
      * @param out is the output stream to output to.
+     * @param isAnsi tells if the maze is redrawn in place with ANSI sequences.
      */
-    Output(const model::Game *game, std::ostream &out)
-        : game_{game}, out_{out}
+    Output(const model::Game *game, std::ostream &out, bool isAnsi = false)
+        : game_{game}, out_{out}, isAnsi_{isAnsi},
+          frame_{FRAME_ROWS, FRAME_WIDTH}, lastFrame_{FRAME_ROWS, FRAME_WIDTH},
+          hasLastFrame_{false}
     {}
 
     /**
@@ -72,7 +95,9 @@ public:
     void printPlayer(const model::Player &p) const;
 
     /**
-     * @brief Prints the current state of the game maze.
+     * @brief Prints the current state of the game maze and the current maze
+     * card. In ANSI mode, the cursor is then put under the maze and the rest
+     * of the console is erased.
      */
     void printMaze() const;
 
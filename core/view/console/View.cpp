@@ -18,11 +18,12 @@ unsigned View::readCoordinate(const std::string &msg) const
             std::cout << msg;
             coordinate = lineFromKbd<unsigned>();
         } catch (const std::exception & e) {
-            std::cout << "The coordinate should be a number between 1 and 7! ";
+            std::cout << "The coordinate should be a number between 1 and "
+                      << model::MazeBitboard::SIZE << "! ";
             std::cout << "(" << e.what() << ")" << std::endl;
         }
     }
-    while (coordinate < 1 || 7 < coordinate);
+    while (coordinate < 1 || model::MazeBitboard::SIZE < coordinate);
     return coordinate;
 }
 
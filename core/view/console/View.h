@@ -20,9 +20,19 @@ public:
     /**
      * @brief Constructs this view with the game to represent.
      * @param game is the game to represent.
+     * @param isAnsi tells if the maze is redrawn in place with ANSI sequences.
      */
-    explicit View(const model::Game *game)
-        : out{game, std::cout}
+    explicit View(const model::Game *game, bool isAnsi = false)
+        : out{game, std::cout, isAnsi}
+    {}
+
+    /**
+     * @brief Constructs this view printing to the given stream.
+     * @param game is the game to represent.
+     * @param stream is the output stream to print to.
+     */
+    View(const model::Game *game, std::ostream &stream)
+        : out{game, stream}
     {}
 
     /**
@@ -81,7 +91,7 @@ public:
 
     /**
      * @brief Reads a coordinate from the user. A coordinate should be between
-     * 1 and 7.
+     * 1 and MazeBitboard::SIZE.
      *
      * @param msg is the message that prompts the user.
      * @return the coordinate entered by the user.
@@ -8,6 +8,7 @@
 #include <Qt>
 #include <QMessageBox>
 
+#include "CellSet.h"
 #include "Game.h"
 #include "MazeCard.h"
 #include "GameWindow.h"
@@ -20,15 +21,12 @@
 
 using namespace labyrinth::model;
 
-static void clear(QLayout *grid) {
-    QLayoutItem *child;
-    while ((child = grid->takeAt(0)) != 0);
-}
-
 GameWindow::GameWindow(Game *game, QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::GameWindow),
-    game_{game}
+    game_{game},
+    currentMazeCard_{nullptr},
+    drawnOccupiedCells_{game->getOccupancy().getOccupiedCells()}
 {
     ui->setupUi(this);
     setWindowTitle("Labyrinth");
@@ -44,9 +42,19 @@ GameWindow::GameWindow(Game *game, QWidget *parent) :
 }
 
 void GameWindow::update(const nvs::Subject * subject) {
-    this->setupBoard();
-    this->setupCurrentMazecard();
-    this->setupPlayersData();
+    update(subject, nvs::ALL_CHANGES);
+}
+
+void GameWindow::update(const nvs::Subject *, nvs::Changes changes) {
+    if (changes & (Game::MAZE_CHANGED | Game::PLAYERS_MOVED)) {
+        this->refreshBoard(changes);
+    }
+    if (changes & Game::MAZE_CHANGED) {
+        currentMazeCard_->refresh();
+    }
+    if (changes & (Game::TURN_CHANGED | Game::OBJECTIVES_CHANGED)) {
+        this->refreshPlayersData();
+    }
 }
 
 GameWindow::~GameWindow()
@@ -57,7 +65,7 @@ GameWindow::~GameWindow()
 void GameWindow::rotateCurrentMazeCard() {
     try {
         game_->getCurrentMazeCard().rotate();
-        setupCurrentMazecard();
+        currentMazeCard_->refresh();
     } catch (const std::exception &e) {
         QMessageBox::information(this, tr("Error"), tr(e.what()));
     }
@@ -70,7 +78,6 @@ void GameWindow::passTurn(){
     } catch (const std::exception &e) {
         QMessageBox::information(this,tr("Caution"),tr(e.what()));
     }
-    setupConnection();
 }
 
 void GameWindow::handleClickedPathway() {
@@ -79,20 +86,24 @@ void GameWindow::handleClickedPathway() {
     MazePosition pos{pathway->getRow(), pathway->getColumn()};
     try {
         if (!game_->isOver()) {
-            if (game_->getCurrentPlayer().isReadyToMove()) {
-                game_->selectPlayerPosition(pos);
-                game_->moveCurrentPlayer();
-                if (game_->hasCurrentPlayerFoundObjective()) {
-                    game_->getCurrentPlayer().turnCurrentObjectiveOver();
-                    game_->getCurrentPlayer().nextObjective();
-                    QMessageBox::information(this, tr("Nice!"), "You have found an objective!");
+            bool hasFoundObjective = false;
+            {
+                nvs::Subject::Batch batch{*game_};
+                if (game_->getCurrentPlayer().isReadyToMove()) {
+                    game_->selectPlayerPosition(pos);
+                    game_->moveCurrentPlayer();
+                    hasFoundObjective = game_->collectObjective();
+                } else {
+                    game_->selectInsertionPosition(pos);
+                    game_->movePathWays();
+                }
+                if (game_->getCurrentPlayer().isDone()) {
+                    game_->nextPlayer();
                 }
-            } else {
-                game_->selectInsertionPosition(pos);
-                game_->movePathWays();
+                batch.commit();
             }
-            if (game_->getCurrentPlayer().isDone()) {
-                game_->nextPlayer();
+            if (hasFoundObjective) {
+                QMessageBox::information(this, tr("Nice!"), "You have found an objective!");
             }
         } else {
             Player winner = game_->getWinner();
@@ -102,31 +113,51 @@ void GameWindow::handleClickedPathway() {
     } catch (const std::exception &e) {
         QMessageBox::information(this, tr("Caution"), tr(e.what()));
     }
-    setupConnection();
 }
 
 void GameWindow::setupBoard() {
-    clear(ui->board);
     for (unsigned row = 0; row < Maze::SIZE; ++row) {
         for (unsigned col = 0; col < Maze::SIZE; ++col) {
-            ui->board->addWidget(new PathwayWidget(game_, row, col), row, col);
+            PathwayWidget *pathway = new PathwayWidget(game_, row, col);
+            pathways_.push_back(pathway);
+            ui->board->addWidget(pathway, row, col);
         }
     }
 }
 
+void GameWindow::refreshBoard(nvs::Changes changes) {
+    const Bitboard occupied = game_->getOccupancy().getOccupiedCells();
+    CellSet cells{occupied | drawnOccupiedCells_};
+    if (changes == nvs::ALL_CHANGES) {
+        cells = CellSet{MazeBitboard::ALL};
+    } else if (changes & Game::MAZE_CHANGED) {
+        cells = cells | game_->getMaze().getLastChangedCells();
+    }
+    for (const MazePosition &position : cells) {
+        pathways_[MazeBitboard::getCell(position)]->refresh();
+    }
+    drawnOccupiedCells_ = occupied;
+}
+
 void GameWindow::setupPlayersData() {
-    clear(ui->players);
-    for (auto player : game_->getPlayers()) {
-        ui->players->addWidget(new PlayerDataWidget(
-                                   player,
-                                   game_->getCurrentPlayer() == player)
-                               );
+    for (unsigned index = 0; index < game_->getNbOfPlayers(); ++index) {
+        PlayerDataWidget *data = new PlayerDataWidget(
+                    game_->getPlayer(index), game_->getCurrentPlayerIndex() == index);
+        playersData_.push_back(data);
+        ui->players->addWidget(data);
+    }
+}
+
+void GameWindow::refreshPlayersData() {
+    for (unsigned index = 0; index < playersData_.size(); ++index) {
+        playersData_[index]->setPlayer(game_->getPlayer(index),
+                                       game_->getCurrentPlayerIndex() == index);
     }
 }
 
 void GameWindow::setupCurrentMazecard() {
-    clear(ui->currentMazeCard);
-    ui->currentMazeCard->addWidget(new PathwayWidget(game_));
+    currentMazeCard_ = new PathwayWidget(game_);
+    ui->currentMazeCard->addWidget(currentMazeCard_);
 }
 
 void GameWindow::setupObjectives() {
@@ -139,12 +170,9 @@ void GameWindow::setupObjectives() {
 }
 
 void GameWindow::setupConnection() {
-    for (int i{0}; i < ui->board->count(); ++i) {
-        QLayoutItem *item = ui->board->itemAt(i);
-        if (dynamic_cast<QWidgetItem *>(item)) {
-            connect(item->widget(), SIGNAL(clicked()), this, SLOT(handleClickedPathway()),
-                    Qt::UniqueConnection);
-        }
+    for (PathwayWidget *pathway : pathways_) {
+        connect(pathway, SIGNAL(clicked()), this, SLOT(handleClickedPathway()),
+                Qt::UniqueConnection);
     }
 }
 
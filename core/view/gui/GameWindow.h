@@ -2,6 +2,7 @@
 #define GAMEWINDOW_H
 
 #include <QMainWindow>
+#include <vector>
 #include "Game.h"
 #include "observer/Subject.h"
 #include "observer/Observer.h"
@@ -10,6 +11,9 @@ namespace Ui {
 class GameWindow;
 }
 
+class PathwayWidget;
+class PlayerDataWidget;
+
 /**
  * @brief Is used to display the main window of the game.
  */
@@ -34,6 +38,14 @@ public:
      */
     void update(const nvs::Subject * subject) override;
 
+    /**
+     * @brief Updates the parts of this window showing what changed.
+     *
+     * @param subject is the subject.
+     * @param changes are the Game::Change flags of what changed.
+     */
+    void update(const nvs::Subject * subject, nvs::Changes changes) override;
+
     ~GameWindow();
 
 public slots:
@@ -56,15 +68,30 @@ public slots:
 private:
 
     /**
-     * @brief Sets the board of the window up.
+     * @brief Sets the board of the window up. The pathway widgets are created
+     * once and kept for the whole game.
      */
     void setupBoard();
 
+    /**
+     * @brief Redraws the pathways of the board whose card, objective or
+     * players changed. Only the cells changed by the last insertion and the
+     * cells players stood or stand on are visited, unless everything changed.
+     *
+     * @param changes are the Game::Change flags of what changed.
+     */
+    void refreshBoard(nvs::Changes changes);
+
     /**
      * @brief Sets the data of the players up.
      */
     void setupPlayersData();
 
+    /**
+     * @brief Updates the data of the players.
+     */
+    void refreshPlayersData();
+
     /**
      * @brief Sets the current maze card up in the preview.
      */
@@ -89,6 +116,28 @@ private:
      */
     labyrinth::model::Game *game_;
 
+    /**
+     * @brief Are the widgets of the board, by row then by column.
+     */
+    std::vector<PathwayWidget *> pathways_;
+
+    /**
+     * @brief Is the preview of the current maze card.
+     */
+    PathwayWidget *currentMazeCard_;
+
+    /**
+     * @brief Are the widgets of the data of the players, in the order of the
+     * players.
+     */
+    std::vector<PlayerDataWidget *> playersData_;
+
+    /**
+     * @brief Are the cells the board shows players on, the cells to redraw
+     * once the players moved away.
+     */
+    labyrinth::model::Bitboard drawnOccupiedCells_;
+
 };
 
 #endif // GAMEWINDOW_H
@@ -29,9 +29,9 @@ static void setAsPathway(QLabel *label) {
     label->setStyleSheet("background-color: lightgreen");
 }
 
-static void setPlayer(QLabel *label, labyrinth::model::Player player) {
+static void setPlayer(QLabel *label, labyrinth::model::Player::Color color) {
     QString style;
-    switch (player.getColor()) {
+    switch (color) {
     case labyrinth::model::Player::RED:
         style += "background-color: red";
         break;
@@ -55,12 +55,35 @@ PathwayWidget::PathwayWidget(labyrinth::model::Game *game,
     ui(new Ui::PathwayWidget),
     game_(game),
     row_{row},
-    column_{column}
+    column_{column},
+    isDrawn_{false},
+    shape_{0},
+    object_{NONE},
+    players_{0}
 {
     ui->setupUi(this);
+    refresh();
+}
+
+bool PathwayWidget::refresh() {
+    MazeCard pathway = getPathway();
+    unsigned shape = static_cast<unsigned>(pathway.getShape().getValue());
+    std::uint8_t players = isPreviewPathWayWidget() ? 0
+            : game_->getOccupancy().getPlayersAt(MazePosition{
+                                                     static_cast<unsigned>(row_),
+                                                     static_cast<unsigned>(column_)});
+    if (isDrawn_ && shape == shape_ && pathway.getObject() == object_
+            && players == players_) {
+        return false;
+    }
+    isDrawn_ = true;
+    shape_ = shape;
+    object_ = pathway.getObject();
+    players_ = players;
     setupPathways();
-    if (!isPreviewPathWayWidget()) setupPlayers();
+    setupPlayers();
     setupObjectives();
+    return true;
 }
 
 labyrinth::model::MazeCard PathwayWidget::getPathway() const {
@@ -93,40 +116,38 @@ void PathwayWidget::setupPlayers() {
                 ui->bottomleft,
                 ui->bottomright
     };
-    for (auto player : game_->getPlayers()) {
-        if (player.getPosition() == MazePosition{static_cast<unsigned>(row_), static_cast<unsigned>(column_)}) {
-            if (!availables.empty()) {
-                QLabel * label = availables.back();
-                setPlayer(label, player);
-                availables.pop_back();
-            }
+    for (Player::Color color = Player::RED; color <= Player::GREEN; ++color) {
+        if (((players_ >> color) & 1) && !availables.empty()) {
+            QLabel * label = availables.back();
+            setPlayer(label, color);
+            availables.pop_back();
         }
     }
 }
 
 void PathwayWidget::setupPathways() {
-    MazeCard pathway = getPathway();
     initPathways(ui->pathway);
-    if (pathway.isGoing(UP)) {
+    if (shape_ & UP) {
         setAsPathway(ui->top);
     }
-    if (pathway.isGoing(RIGHT)) {
+    if (shape_ & RIGHT) {
         setAsPathway(ui->right);
     }
-    if (pathway.isGoing(DOWN)) {
+    if (shape_ & DOWN) {
         setAsPathway(ui->bottom);
     }
-    if (pathway.isGoing(LEFT)) {
+    if (shape_ & LEFT) {
         setAsPathway(ui->left);
     }
     setAsPathway(ui->center);
 }
 
 void PathwayWidget::setupObjectives() {
-    Object object = getPathway().getObject();
-    unsigned value = static_cast<unsigned>(object);
+    unsigned value = static_cast<unsigned>(object_);
     std::string text = std::to_string(value + 1);
-    if (object != NONE) {
+    if (object_ != NONE) {
         ui->center->setText(QString::fromStdString(text));
+    } else {
+        ui->center->clear();
     }
 }
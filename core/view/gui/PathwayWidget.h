@@ -3,6 +3,7 @@
 
 #include <QWidget>
 #include <QLabel>
+#include <cstdint>
 #include <vector>
 #include "Game.h"
 
@@ -66,6 +67,15 @@ public:
      */
     bool isPreviewPathWayWidget() const { return row_ < 0 && column_ < 0; }
 
+    /**
+     * @brief Redraws this widget if the shape or the objective of the
+     * represented pathway, or the players standing on it, changed since it was
+     * last drawn.
+     *
+     * @return true if this widget was redrawn.
+     */
+    bool refresh();
+
     ~PathwayWidget();
 
 signals:
@@ -101,7 +111,8 @@ private:
     void setupPathways();
 
     /**
-     * @brief If an objective is located on this
+     * @brief If an objective is located on this pathway, its id is displayed
+     * in the center of this widget.
      */
     void setupObjectives();
 
@@ -124,6 +135,27 @@ private:
      */
     int column_;
 
+    /**
+     * @brief Tells if this widget was drawn at least once.
+     */
+    bool isDrawn_;
+
+    /**
+     * @brief Is the shape of the pathway when this widget was last drawn.
+     */
+    unsigned shape_;
+
+    /**
+     * @brief Is the object of the pathway when this widget was last drawn.
+     */
+    labyrinth::model::Object object_;
+
+    /**
+     * @brief Are the players standing on the pathway when this widget was last
+     * drawn, one bit per color.
+     */
+    std::uint8_t players_;
+
 };
 
 #endif // PATHWAYWIDGET_H
@@ -35,6 +35,12 @@ PlayerDataWidget::PlayerDataWidget(model::Player player,
     setupBackgroundColor();
 }
 
+void PlayerDataWidget::setPlayer(const model::Player &player, bool isCurrentPlayer) {
+    player_ = player;
+    setupPlayerData(isCurrentPlayer);
+    setupBackgroundColor();
+}
+
 void PlayerDataWidget::setupPlayerData(bool isCurrentPlayer) {
     std::string name = view::toString(player_.getColor()) + " player";
     std::string status = getStatus(player_, isCurrentPlayer);
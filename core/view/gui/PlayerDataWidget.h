@@ -30,6 +30,14 @@ public:
                               bool isCurrentPlayer = false,
                               QWidget *parent = 0);
 
+    /**
+     * @brief Updates the data displayed by this widget.
+     *
+     * @param player is the player to display the data of.
+     * @param isCurrentPlayer tells if the player is the current one.
+     */
+    void setPlayer(const labyrinth::model::Player &player, bool isCurrentPlayer);
+
     ~PlayerDataWidget();
 
 private:
@@ -4,3 +4,9 @@ SRC_DIR = $$PWD
 
 CONFIG -= app_bundle
 CONFIG += c++14
+
+CONFIG(release, debug|release): DEFINES += NDEBUG
+
+# Size of the maze, odd and between 7 and 11: qmake MAZE_SIZE=9
+isEmpty(MAZE_SIZE): MAZE_SIZE = 7
+DEFINES += LABYRINTH_MAZE_SIZE=$$MAZE_SIZE
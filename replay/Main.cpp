@@ -0,0 +1,70 @@
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "Replayer.h"
+
+using namespace labyrinth::replay;
+
+static const char *usage =
+        "usage: ./labyrinth-replay [--threads n] [--failures n] <records file>...\n"
+        "       the files of records are written by labyrinth-sim --record.\n";
+
+/**
+ * @brief Replays files of game records through the model and reports the
+ * records that do not match it. The exit status is 4 if any record fails.
+ */
+int main(int argc, char **argv) {
+
+    ReplayOptions options;
+    std::vector<std::string> paths;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option.compare(0, 2, "--") != 0) {
+                paths.push_back(option);
+                continue;
+            }
+            if (i + 1 == argc) throw std::invalid_argument(option);
+            std::string value = argv[++i];
+            if (option == "--threads") {
+                options.nbOfThreads = std::stoul(value);
+            } else if (option == "--failures") {
+                options.maxNbOfReportedFailures = std::stoul(value);
+            } else {
+                throw std::invalid_argument(option);
+            }
+        }
+        if (paths.empty()) throw std::invalid_argument("no file");
+    } catch (const std::exception &) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    bool isValid = true;
+    try {
+        Replayer replayer{options};
+        for (const std::string &path : paths) {
+            MappedFile file{path};
+            ReplayReport report = replayer.run(file.begin(), file.end());
+            double gamesPerSecond = report.seconds > 0 ? report.nbOfGames / report.seconds : 0;
+            std::cout << std::fixed << std::setprecision(2)
+                      << path << '\n'
+                      << "games:         " << report.nbOfGames << '\n'
+                      << "turns:         " << report.nbOfTurns << '\n'
+                      << "seconds:       " << report.seconds << '\n'
+                      << "games/second:  " << gamesPerSecond << '\n'
+                      << "failures:      " << report.nbOfFailures << '\n';
+            for (const std::string &failure : report.failures) {
+                std::cout << "  " << failure << '\n';
+            }
+            if (report.nbOfFailures > 0) isValid = false;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 2;
+    }
+    return isValid ? 0 : 4;
+}
@@ -0,0 +1,47 @@
+#include "MappedFile.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace labyrinth { namespace replay {
+
+MappedFile::MappedFile(const std::string &path)
+    : data_{nullptr},
+      size_{0}
+{
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+    }
+    struct stat status;
+    if (fstat(file, &status) != 0) {
+        std::string error = std::strerror(errno);
+        close(file);
+        throw std::runtime_error("Cannot read " + path + ": " + error);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ > 0) {
+        void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED) {
+            std::string error = std::strerror(errno);
+            close(file);
+            throw std::runtime_error("Cannot map " + path + ": " + error);
+        }
+        madvise(data, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const unsigned char *>(data);
+    }
+    close(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_) munmap(const_cast<unsigned char *>(data_), size_);
+}
+
+}}
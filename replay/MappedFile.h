@@ -0,0 +1,64 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace labyrinth { namespace replay {
+
+/**
+ * @brief Maps a whole file in memory, read only. The pages are loaded by the
+ * system when they are read, so a file larger than the memory can be read.
+ */
+class MappedFile
+{
+
+    const unsigned char *data_;
+
+    std::size_t size_;
+
+public:
+
+    /**
+     * @brief Maps the given file.
+     *
+     * @param path is the path of the file to map.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Gets the first byte of the file.
+     *
+     * @return the beginning of the file, null if it is empty.
+     */
+    const unsigned char *begin() const { return data_; }
+
+    /**
+     * @brief Gets the end of the file.
+     *
+     * @return the byte following the last byte of the file.
+     */
+    const unsigned char *end() const { return data_ + size_; }
+
+    /**
+     * @brief Gets the size of the file.
+     *
+     * @return the number of bytes of the file.
+     */
+    std::size_t size() const { return size_; }
+
+};
+
+}}
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,125 @@
+#include "Replayer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "Game.h"
+
+using namespace labyrinth::model;
+
+namespace labyrinth { namespace replay {
+
+Replayer::Replayer(const ReplayOptions &options)
+    : options_{options}
+{
+    if (options_.nbOfThreads == 0) {
+        options_.nbOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+bool Replayer::verify(const GameRecord &record, std::string &error)
+{
+    try {
+        Game game = record.createGame();
+        const std::vector<Turn> &turns = record.getTurns();
+        for (std::size_t turn = 0; turn < turns.size(); ++turn) {
+            if (game.isOver()) {
+                error = "turn " + std::to_string(turn + 1) + " is played after the end of the game";
+                return false;
+            }
+            try {
+                game.applyTurn(turns[turn]);
+            } catch (const std::exception &e) {
+                error = "turn " + std::to_string(turn + 1) + " is illegal: " + e.what();
+                return false;
+            }
+        }
+        if (game.isOver() != record.isOver()) {
+            error = game.isOver() ? "the game is over but is recorded as not over"
+                                  : "the game is not over but is recorded as over";
+            return false;
+        }
+        if (game.getKey() != record.getFinalKey()) {
+            error = "the final state does not match the recorded one";
+            return false;
+        }
+    } catch (const std::exception &e) {
+        error = std::string{"the game cannot be set up: "} + e.what();
+        return false;
+    }
+    return true;
+}
+
+ReplayReport Replayer::run(const unsigned char *data, const unsigned char *end) const
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<const unsigned char *> records;
+    for (data = GameRecord::readFileHeader(data, end); data < end;
+         data += GameRecord::getSize(data, end)) {
+        records.push_back(data);
+    }
+
+    ReplayReport report;
+    std::atomic<std::size_t> next{0};
+    std::mutex mutex;
+    std::exception_ptr error;
+    auto work = [&]() {
+        ReplayReport local;
+        GameRecord record;
+        std::string failure;
+        try {
+            for (std::size_t index = next++; index < records.size(); index = next++) {
+                const unsigned char *bytes = records[index];
+                ++local.nbOfGames;
+                bool isValid;
+                try {
+                    record.readFrom(bytes, end);
+                    local.nbOfTurns += record.getTurns().size();
+                    isValid = verify(record, failure);
+                } catch (const std::invalid_argument &e) {
+                    failure = e.what();
+                    isValid = false;
+                }
+                if (!isValid) {
+                    ++local.nbOfFailures;
+                    if (local.failures.size() < options_.maxNbOfReportedFailures) {
+                        local.failures.push_back("record " + std::to_string(index + 1)
+                                                 + ": " + failure);
+                    }
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        report.nbOfGames += local.nbOfGames;
+        report.nbOfTurns += local.nbOfTurns;
+        report.nbOfFailures += local.nbOfFailures;
+        for (std::string &description : local.failures) {
+            if (report.failures.size() < options_.maxNbOfReportedFailures) {
+                report.failures.push_back(std::move(description));
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned thread = 1; thread < options_.nbOfThreads; ++thread) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    report.seconds = elapsed.count();
+    if (error) std::rethrow_exception(error);
+    return report;
+}
+
+}}
@@ -0,0 +1,108 @@
+#ifndef REPLAYER_H
+#define REPLAYER_H
+
+#include <string>
+#include <vector>
+
+#include "GameRecord.h"
+
+namespace labyrinth { namespace replay {
+
+/**
+ * @brief Are the settings of a verification of game records.
+ */
+struct ReplayOptions
+{
+
+    /**
+     * @brief Is the number of worker threads, 0 for one per core.
+     */
+    unsigned nbOfThreads = 0;
+
+    /**
+     * @brief Is the maximum number of failures described in the report.
+     */
+    unsigned maxNbOfReportedFailures = 10;
+
+};
+
+/**
+ * @brief Are the results of a verification of game records.
+ */
+struct ReplayReport
+{
+
+    /**
+     * @brief Is the number of verified games.
+     */
+    unsigned long long nbOfGames = 0;
+
+    /**
+     * @brief Is the total number of turns replayed, over all the games.
+     */
+    unsigned long long nbOfTurns = 0;
+
+    /**
+     * @brief Is the number of games whose record does not match the model.
+     */
+    unsigned long long nbOfFailures = 0;
+
+    /**
+     * @brief Are the descriptions of the first failures, in no given order.
+     */
+    std::vector<std::string> failures;
+
+    /**
+     * @brief Is the wall clock duration of the verification, in seconds.
+     */
+    double seconds = 0;
+
+};
+
+/**
+ * @brief Replays game records through the model and checks that every turn is
+ * legal and that the games end as recorded. The records are spread over worker
+ * threads, each thread replaying a whole game at a time.
+ */
+class Replayer
+{
+
+    /**
+     * @brief Are the settings of the verification.
+     */
+    ReplayOptions options_;
+
+public:
+
+    /**
+     * @brief Constructs this replayer.
+     *
+     * @param options are the settings of the verification.
+     */
+    explicit Replayer(const ReplayOptions &options);
+
+    /**
+     * @brief Replays the given record.
+     *
+     * @param record is the record to replay.
+     * @param error is set to the reason of the failure, if any.
+     * @return true if every turn is legal and the game ends as recorded.
+     */
+    static bool verify(const model::GameRecord &record, std::string &error);
+
+    /**
+     * @brief Verifies the records of the given file of records (see
+     * GameRecord::writeFileHeader).
+     *
+     * @param data is the beginning of the file.
+     * @param end is the end of the file.
+     * @return the results of the verification.
+     * @throws std::invalid_argument if the bytes are not a file of records.
+     */
+    ReplayReport run(const unsigned char *data, const unsigned char *end) const;
+
+};
+
+}}
+
+#endif // REPLAYER_H
@@ -0,0 +1,37 @@
+include(../defaults.pri)
+
+TEMPLATE = app
+TARGET = labyrinth-replay
+CONFIG += console thread
+CONFIG -= qt
+
+SOURCES += \
+    Main.cpp \
+    MappedFile.cpp \
+    Replayer.cpp \
+    ../core/model/DistanceField.cpp \
+    ../core/model/Game.cpp \
+    ../core/model/GameRecord.cpp \
+    ../core/model/GameState.cpp \
+    ../core/model/Maze.cpp \
+    ../core/model/MoveGenerator.cpp \
+    ../core/model/MazeBitboard.cpp \
+    ../core/model/MazeCell.cpp \
+    ../core/model/MazeCard.cpp \
+    ../core/model/MazeCardsBuilder.cpp \
+    ../core/model/MazeCardShape.cpp \
+    ../core/model/MazePosition.cpp \
+    ../core/model/ObjectivesDeck.cpp \
+    ../core/model/Zobrist.cpp \
+    ../core/observer/Subject.cpp
+
+HEADERS += \
+    MappedFile.h \
+    Replayer.h \
+    ../core/model/GameRecord.h
+
+DESTDIR = $$PWD/../build
+
+INCLUDEPATH += \
+    $$PWD \
+    ../core/model
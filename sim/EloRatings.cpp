@@ -0,0 +1,128 @@
+#include "EloRatings.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace labyrinth { namespace sim {
+
+/**
+ * @brief Is the largest number of iterations of the estimation.
+ */
+static constexpr unsigned MAX_NB_OF_ITERATIONS = 10000;
+
+/**
+ * @brief Is the relative change of the strengths under which the estimation
+ * stops.
+ */
+static constexpr double TOLERANCE = 1e-10;
+
+/**
+ * @brief Is the number of Elo points of a strength ten times as high.
+ */
+static constexpr double ELO_PER_DECADE = 400;
+
+/**
+ * @brief Is the quantile of the normal distribution bounding 95% of it.
+ */
+static constexpr double Z_95 = 1.96;
+
+EloRatings::EloRatings(const std::vector<std::string> &entrants)
+    : ratings_(entrants.size()),
+      duels_(entrants.size() * entrants.size(), 0),
+      scores_(entrants.size(), 0)
+{
+    for (unsigned index = 0; index < entrants.size(); ++index) {
+        ratings_[index].entrant = entrants[index];
+    }
+}
+
+void EloRatings::addDuel(unsigned first, unsigned second, double firstScore)
+{
+    if (first == second) return;
+    std::size_t nbOfEntrants = ratings_.size();
+    duels_[first * nbOfEntrants + second] += 1;
+    duels_[second * nbOfEntrants + first] += 1;
+    scores_[first] += firstScore;
+    scores_[second] += 1 - firstScore;
+}
+
+void EloRatings::addGame(const std::vector<unsigned> &players, unsigned winner)
+{
+    for (unsigned player : players) {
+        if (player >= ratings_.size()) {
+            throw std::invalid_argument(std::to_string(player) + " is not an entrant.");
+        }
+    }
+    if (winner > players.size()) {
+        throw std::invalid_argument(std::to_string(winner) + " is not a seat of the game.");
+    }
+    for (unsigned seat = 0; seat < players.size(); ++seat) {
+        Rating &rating = ratings_[players[seat]];
+        ++rating.nbOfGames;
+        if (seat == winner) ++rating.nbOfWins;
+        if (winner == players.size()) ++rating.nbOfDraws;
+    }
+    if (winner == players.size()) {
+        for (unsigned first = 0; first < players.size(); ++first) {
+            for (unsigned second = first + 1; second < players.size(); ++second) {
+                addDuel(players[first], players[second], 0.5);
+            }
+        }
+    } else {
+        for (unsigned seat = 0; seat < players.size(); ++seat) {
+            if (seat != winner) addDuel(players[winner], players[seat], 1);
+        }
+    }
+}
+
+std::vector<Rating> EloRatings::compute() const
+{
+    const std::size_t nbOfEntrants = ratings_.size();
+    std::vector<Rating> ratings = ratings_;
+    if (nbOfEntrants < 2) return ratings;
+    auto getDuels = [&](std::size_t first, std::size_t second) {
+        return duels_[first * nbOfEntrants + second] + 1;
+    };
+
+    // Minorization-maximization of the likelihood (Hunter, 2004): each
+    // strength is set to its score over its expected number of wins per unit
+    // of strength, which never decreases the likelihood.
+    std::vector<double> strengths(nbOfEntrants, 1);
+    std::vector<double> next(nbOfEntrants);
+    for (unsigned iteration = 0; iteration < MAX_NB_OF_ITERATIONS; ++iteration) {
+        double change = 0;
+        for (std::size_t first = 0; first < nbOfEntrants; ++first) {
+            double expected = 0;
+            for (std::size_t second = 0; second < nbOfEntrants; ++second) {
+                if (second == first) continue;
+                expected += getDuels(first, second) / (strengths[first] + strengths[second]);
+            }
+            next[first] = (scores_[first] + 0.5 * (nbOfEntrants - 1)) / expected;
+        }
+        double logMean = 0;
+        for (double strength : next) logMean += std::log(strength);
+        double scale = std::exp(-logMean / nbOfEntrants);
+        for (std::size_t index = 0; index < nbOfEntrants; ++index) {
+            next[index] *= scale;
+            change = std::max(change, std::abs(next[index] - strengths[index]) / strengths[index]);
+        }
+        strengths.swap(next);
+        if (change < TOLERANCE) break;
+    }
+
+    const double eloPerLog = ELO_PER_DECADE / std::log(10.0);
+    for (std::size_t first = 0; first < nbOfEntrants; ++first) {
+        double information = 0;
+        for (std::size_t second = 0; second < nbOfEntrants; ++second) {
+            if (second == first) continue;
+            double p = strengths[first] / (strengths[first] + strengths[second]);
+            information += getDuels(first, second) * p * (1 - p);
+        }
+        ratings[first].elo = 1500 + eloPerLog * std::log(strengths[first]);
+        ratings[first].margin = Z_95 * eloPerLog / std::sqrt(information);
+    }
+    return ratings;
+}
+
+}}
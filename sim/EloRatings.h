@@ -0,0 +1,110 @@
+#ifndef ELORATINGS_H
+#define ELORATINGS_H
+
+#include <string>
+#include <vector>
+
+namespace labyrinth { namespace sim {
+
+/**
+ * @brief Is the estimated strength of an entrant of a tournament.
+ */
+struct Rating
+{
+
+    /**
+     * @brief Is the name of the entrant.
+     */
+    std::string entrant;
+
+    /**
+     * @brief Is the number of games the entrant took part in.
+     */
+    unsigned nbOfGames = 0;
+
+    /**
+     * @brief Is the number of games the entrant won.
+     */
+    unsigned nbOfWins = 0;
+
+    /**
+     * @brief Is the number of games the entrant ended in a draw.
+     */
+    unsigned nbOfDraws = 0;
+
+    /**
+     * @brief Is the estimated Elo rating, the ratings averaging 1500.
+     */
+    double elo = 1500;
+
+    /**
+     * @brief Is the half width of the 95% confidence interval of the rating.
+     */
+    double margin = 0;
+
+};
+
+/**
+ * @brief Estimates the Elo ratings of the entrants of a tournament from the
+ * results of their games.
+ *
+ * A game of many players is counted as duels: its winner beats each of the
+ * other players, and the players of a draw all draw against each other. The
+ * ratings are the maximum likelihood estimate of the Bradley-Terry model of
+ * the duels, so they do not depend on the order of the games. Each pair of
+ * entrants gets one virtual draw, so that an entrant winning or losing every
+ * duel still has a finite rating. The confidence intervals come from the
+ * curvature of the likelihood.
+ */
+class EloRatings
+{
+
+    /**
+     * @brief Are the ratings of the entrants, with their tallies.
+     */
+    std::vector<Rating> ratings_;
+
+    /**
+     * @brief Is the number of duels between each pair of entrants, indexed by
+     * first * nbOfEntrants + second.
+     */
+    std::vector<double> duels_;
+
+    /**
+     * @brief Is the score of each entrant over his/ her duels, 1 per win and
+     * 1/2 per draw.
+     */
+    std::vector<double> scores_;
+
+    void addDuel(unsigned first, unsigned second, double firstScore);
+
+public:
+
+    /**
+     * @brief Constructs the ratings of the given entrants, before any game.
+     *
+     * @param entrants are the names of the entrants.
+     */
+    explicit EloRatings(const std::vector<std::string> &entrants);
+
+    /**
+     * @brief Adds the result of a game.
+     *
+     * @param players are the indices of the entrants of the game, one per seat.
+     * @param winner is the seat of the winner, players.size() for a draw.
+     * @throws std::invalid_argument if an entrant or the winner is not valid.
+     */
+    void addGame(const std::vector<unsigned> &players, unsigned winner);
+
+    /**
+     * @brief Estimates the ratings from the games added so far.
+     *
+     * @return the ratings of the entrants, in their order of construction.
+     */
+    std::vector<Rating> compute() const;
+
+};
+
+}}
+
+#endif // ELORATINGS_H
@@ -0,0 +1,173 @@
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Simulator.h"
+#include "Tournament.h"
+
+using namespace labyrinth::sim;
+
+static const char *usage =
+        "usage: ./labyrinth-sim [--games n] [--threads n] [--players n]"
+        " [--max-turns n] [--seed n] [--policies p1,p2,...] [--simplified]"
+        " [--record file]\n"
+        "       ./labyrinth-sim --tournament round-robin|swiss [--rounds n]"
+        " [--player-counts n1,n2,...] [--rules simplified,full] [--threads n]"
+        " [--max-turns n] [--seed n] [--policies p1,p2,...] [--games-csv file]"
+        " [--ratings-csv file]\n"
+        "       the policies are random, greedy, search or mcts.\n";
+
+static std::vector<std::string> split(const std::string &text)
+{
+    std::vector<std::string> items;
+    std::istringstream stream{text};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+static std::vector<unsigned> splitNumbers(const std::string &text)
+{
+    std::vector<unsigned> numbers;
+    for (const std::string &item : split(text)) {
+        numbers.push_back(std::stoul(item));
+    }
+    return numbers;
+}
+
+/**
+ * @brief Plays the given tournament and prints the ratings of its entrants.
+ */
+static void runTournament(const TournamentOptions &options)
+{
+    TournamentReport report = Tournament{options}.run();
+    double gamesPerSecond = report.seconds > 0 ? report.games.size() / report.seconds : 0;
+    std::cout << std::fixed << std::setprecision(2)
+              << "games:         " << report.games.size() << '\n'
+              << "seconds:       " << report.seconds << '\n'
+              << "games/second:  " << gamesPerSecond << '\n'
+              << std::setprecision(1);
+    for (const Rating &rating : report.ratings) {
+        std::cout << std::left << std::setw(15) << rating.entrant + ":" << std::right
+                  << rating.elo << " +/- " << rating.margin << " (" << rating.nbOfWins
+                  << " wins, " << rating.nbOfDraws << " draws in " << rating.nbOfGames
+                  << " games)\n";
+    }
+}
+
+/**
+ * @brief Plays a batch of games between automated players and prints the
+ * throughput and the results, or plays a tournament between them and prints
+ * their ratings.
+ */
+int main(int argc, char **argv) {
+
+    SimulationOptions options;
+    TournamentOptions tournament;
+    bool isTournament = false;
+    bool hasRules = false;
+    bool hasPolicies = false;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option == "--simplified") {
+                options.isSimplified = true;
+                continue;
+            }
+            if (i + 1 == argc) throw std::invalid_argument(option);
+            std::string value = argv[++i];
+            if (option == "--games") {
+                options.nbOfGames = std::stoul(value);
+            } else if (option == "--threads") {
+                options.nbOfThreads = std::stoul(value);
+            } else if (option == "--players") {
+                options.nbOfPlayers = std::stoul(value);
+            } else if (option == "--max-turns") {
+                options.maxNbOfTurns = std::stoul(value);
+            } else if (option == "--seed") {
+                options.seed = std::stoul(value);
+            } else if (option == "--policies") {
+                options.policies = split(value);
+                hasPolicies = true;
+            } else if (option == "--record") {
+                options.recordPath = value;
+            } else if (option == "--tournament") {
+                isTournament = true;
+                if (value == "round-robin") {
+                    tournament.format = TournamentOptions::Format::ROUND_ROBIN;
+                } else if (value == "swiss") {
+                    tournament.format = TournamentOptions::Format::SWISS;
+                } else {
+                    throw std::invalid_argument(value);
+                }
+            } else if (option == "--rounds") {
+                tournament.nbOfRounds = std::stoul(value);
+            } else if (option == "--player-counts") {
+                tournament.nbOfPlayers = splitNumbers(value);
+            } else if (option == "--rules") {
+                hasRules = true;
+                tournament.playsSimplified = false;
+                tournament.playsFull = false;
+                for (const std::string &rules : split(value)) {
+                    if (rules == "simplified") {
+                        tournament.playsSimplified = true;
+                    } else if (rules == "full") {
+                        tournament.playsFull = true;
+                    } else {
+                        throw std::invalid_argument(rules);
+                    }
+                }
+            } else if (option == "--games-csv") {
+                tournament.gamesPath = value;
+            } else if (option == "--ratings-csv") {
+                tournament.ratingsPath = value;
+            } else {
+                throw std::invalid_argument(option);
+            }
+        }
+    } catch (const std::exception &) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    if (isTournament) {
+        tournament.nbOfThreads = options.nbOfThreads;
+        tournament.maxNbOfTurns = options.maxNbOfTurns;
+        tournament.seed = options.seed;
+        if (hasPolicies) tournament.entrants = options.policies;
+        if (!hasRules && options.isSimplified) tournament.playsFull = false;
+        try {
+            runTournament(tournament);
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << '\n' << usage;
+            return 2;
+        }
+        return 0;
+    }
+
+    try {
+        SimulationReport report = Simulator{options}.run();
+        double gamesPerSecond = report.seconds > 0 ? report.nbOfGames / report.seconds : 0;
+        double averageTurns = report.nbOfGames > 0
+                ? static_cast<double>(report.nbOfTurns) / report.nbOfGames : 0;
+        std::cout << std::fixed << std::setprecision(2)
+                  << "games:         " << report.nbOfGames << '\n'
+                  << "seconds:       " << report.seconds << '\n'
+                  << "games/second:  " << gamesPerSecond << '\n'
+                  << "average turns: " << averageTurns << '\n';
+        for (unsigned player = 0; player < report.wins.size(); ++player) {
+            std::cout << "player " << player + 1 << " wins: " << report.wins[player]
+                      << " (" << 100.0 * report.wins[player] / report.nbOfGames << "%)\n";
+        }
+        std::cout << "draws:         " << report.draws
+                  << " (" << 100.0 * report.draws / report.nbOfGames << "%)\n";
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n' << usage;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include "Simulator.h"
+#include "PolicyFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+namespace labyrinth { namespace sim {
+
+Simulator::Simulator(const SimulationOptions &options)
+    : options_{options}
+{
+    if (options_.nbOfPlayers < Game::MIN_NB_OF_PLAYERS
+            || Game::MAX_NB_OF_PLAYERS < options_.nbOfPlayers) {
+        throw std::invalid_argument(std::to_string(options_.nbOfPlayers)
+                                    + " is not a valid number of player!");
+    }
+    if (!options_.recordPath.empty()
+            && options_.maxNbOfTurns > GameRecord::MAX_NB_OF_TURNS) {
+        throw std::invalid_argument("A recorded game cannot last more than "
+                                    + std::to_string(GameRecord::MAX_NB_OF_TURNS)
+                                    + " turns.");
+    }
+    if (options_.policies.empty()) {
+        throw std::invalid_argument("At least one policy is needed.");
+    }
+    for (const std::string &name : options_.policies) {
+        PolicyFactory::getPolicy(name, 0);
+    }
+    if (options_.nbOfThreads == 0) {
+        options_.nbOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+/**
+ * @brief Is the number of bytes of records a thread gathers before writing
+ * them to the file.
+ */
+static constexpr std::size_t RECORDS_BUFFER_SIZE = 1 << 20;
+
+unsigned Simulator::playGame(unsigned index, unsigned &nbOfTurns,
+                             GameRecord *record) const
+{
+    unsigned seed = options_.seed + index;
+    Game game{options_.nbOfPlayers, options_.isSimplified, seed};
+    RandomEngine seeds{seed};
+    std::vector<std::unique_ptr<Policy>> policies;
+    for (unsigned player = 0; player < options_.nbOfPlayers; ++player) {
+        const std::string &name = options_.policies.at(
+                    std::min<std::size_t>(player, options_.policies.size() - 1));
+        policies.push_back(PolicyFactory::getPolicy(name, static_cast<unsigned>(seeds())));
+    }
+    nbOfTurns = 0;
+    while (!game.isOver() && nbOfTurns < options_.maxNbOfTurns) {
+        Policy &policy = *policies.at(game.getCurrentPlayerIndex());
+        Turn turn = policy.chooseTurn(game);
+        game.playTurn(turn);
+        if (record) record->addTurn(turn);
+        ++nbOfTurns;
+    }
+    if (record) record->finish(game);
+    if (!game.isOver()) return options_.nbOfPlayers;
+    Player::Color winner = game.getWinner().getColor();
+    for (unsigned player = 0; player < game.getNbOfPlayers(); ++player) {
+        if (game.getPlayer(player).getColor() == winner) return player;
+    }
+    return options_.nbOfPlayers;
+}
+
+SimulationReport Simulator::run() const
+{
+    SimulationReport report;
+    report.wins.assign(options_.nbOfPlayers, 0);
+    std::atomic<unsigned> next{0};
+    std::mutex mutex;
+    std::exception_ptr error;
+    std::ofstream records;
+    if (!options_.recordPath.empty()) {
+        records.open(options_.recordPath, std::ios::binary);
+        if (!records) throw std::runtime_error("Cannot write " + options_.recordPath + ".");
+        std::string header;
+        GameRecord::writeFileHeader(header);
+        records.write(header.data(), header.size());
+    }
+    auto write = [&](std::string &bytes) {
+        std::lock_guard<std::mutex> lock{mutex};
+        records.write(bytes.data(), bytes.size());
+        bytes.clear();
+    };
+    auto work = [&]() {
+        SimulationReport local;
+        local.wins.assign(options_.nbOfPlayers, 0);
+        std::string bytes;
+        try {
+            for (unsigned index = next++; index < options_.nbOfGames; index = next++) {
+                unsigned nbOfTurns;
+                GameRecord record{options_.nbOfPlayers, options_.isSimplified,
+                                  options_.seed + index};
+                bool isRecorded = records.is_open();
+                unsigned winner = playGame(index, nbOfTurns, isRecorded ? &record : nullptr);
+                if (isRecorded) {
+                    record.writeTo(bytes);
+                    if (bytes.size() >= RECORDS_BUFFER_SIZE) write(bytes);
+                }
+                if (winner < options_.nbOfPlayers) {
+                    ++local.wins[winner];
+                } else {
+                    ++local.draws;
+                }
+                local.nbOfTurns += nbOfTurns;
+                ++local.nbOfGames;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+        if (!bytes.empty()) write(bytes);
+        std::lock_guard<std::mutex> lock{mutex};
+        report.nbOfGames += local.nbOfGames;
+        report.nbOfTurns += local.nbOfTurns;
+        report.draws += local.draws;
+        for (unsigned player = 0; player < options_.nbOfPlayers; ++player) {
+            report.wins[player] += local.wins[player];
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned thread = 1; thread < options_.nbOfThreads; ++thread) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    report.seconds = elapsed.count();
+    if (error) std::rethrow_exception(error);
+    if (records.is_open() && !records.flush()) {
+        throw std::runtime_error("Cannot write " + options_.recordPath + ".");
+    }
+    return report;
+}
+
+}}
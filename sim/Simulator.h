@@ -0,0 +1,146 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <string>
+#include <vector>
+
+#include "Game.h"
+#include "GameRecord.h"
+
+namespace labyrinth { namespace sim {
+
+/**
+ * @brief Are the settings of a batch of simulated games.
+ */
+struct SimulationOptions
+{
+
+    /**
+     * @brief Is the number of games to play.
+     */
+    unsigned nbOfGames = 1000;
+
+    /**
+     * @brief Is the number of worker threads, 0 for one per core.
+     */
+    unsigned nbOfThreads = 0;
+
+    /**
+     * @brief Is the number of players of each game.
+     */
+    unsigned nbOfPlayers = 2;
+
+    /**
+     * @brief Tells if the games are simplified.
+     */
+    bool isSimplified = false;
+
+    /**
+     * @brief Is the number of turns after which a game is declared a draw.
+     */
+    unsigned maxNbOfTurns = 2000;
+
+    /**
+     * @brief Are the names of the policies of the players, the last one is
+     * used for the remaining players.
+     */
+    std::vector<std::string> policies{"greedy"};
+
+    /**
+     * @brief Is the seed of the first game. The game of index i is set up from
+     * the seed seed + i, and so are the random engines of its policies, so
+     * any game of a batch can be replayed alone.
+     */
+    unsigned seed = 1;
+
+    /**
+     * @brief Is the file the records of the games are written to (see
+     * GameRecord), empty to not record the games.
+     */
+    std::string recordPath;
+
+};
+
+/**
+ * @brief Are the results of a batch of simulated games.
+ */
+struct SimulationReport
+{
+
+    /**
+     * @brief Is the number of games played.
+     */
+    unsigned nbOfGames = 0;
+
+    /**
+     * @brief Is the total number of turns played, over all the games.
+     */
+    unsigned long long nbOfTurns = 0;
+
+    /**
+     * @brief Is the number of games won by each player.
+     */
+    std::vector<unsigned> wins;
+
+    /**
+     * @brief Is the number of games stopped after the maximum number of turns.
+     */
+    unsigned draws = 0;
+
+    /**
+     * @brief Is the wall clock duration of the batch, in seconds.
+     */
+    double seconds = 0;
+
+};
+
+/**
+ * @brief Plays complete games between automated policies, without any view.
+ * The games are spread over worker threads, each thread playing a whole game
+ * at a time.
+ */
+class Simulator
+{
+
+    /**
+     * @brief Are the settings of the simulated games.
+     */
+    SimulationOptions options_;
+
+public:
+
+    /**
+     * @brief Constructs this simulator.
+     *
+     * @param options are the settings of the simulated games.
+     * @throws std::invalid_argument if a policy is unknown, the number of
+     * players is not valid or the recorded games could be too long.
+     */
+    explicit Simulator(const SimulationOptions &options);
+
+    /**
+     * @brief Plays all the games and gathers their results.
+     *
+     * @return the results of the games.
+     */
+    SimulationReport run() const;
+
+private:
+
+    /**
+     * @brief Plays the game of the given index until it is over or the maximum
+     * number of turns is reached.
+     *
+     * @param index is the index of the game, used to seed its policies.
+     * @param nbOfTurns is set to the number of turns played.
+     * @param record receives the turns of the game, if not null.
+     * @return the index of the winner, or the number of players for a draw.
+     */
+    unsigned playGame(unsigned index, unsigned &nbOfTurns,
+                      model::GameRecord *record) const;
+
+};
+
+}}
+
+#endif // SIMULATOR_H
@@ -0,0 +1,233 @@
+#include "Tournament.h"
+#include "Game.h"
+#include "PolicyFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+namespace labyrinth { namespace sim {
+
+Tournament::Tournament(const TournamentOptions &options)
+    : options_{options}
+{
+    if (options_.entrants.size() < 2) {
+        throw std::invalid_argument("At least 2 entrants are needed.");
+    }
+    for (unsigned index = 0; index < options_.entrants.size(); ++index) {
+        const std::string &name = options_.entrants[index];
+        PolicyFactory::getPolicy(name, 0);
+        if (std::find(options_.entrants.begin(), options_.entrants.begin() + index, name)
+                != options_.entrants.begin() + index) {
+            throw std::invalid_argument(name + " takes part twice.");
+        }
+    }
+    for (unsigned nbOfPlayers : options_.nbOfPlayers) {
+        if (nbOfPlayers < Game::MIN_NB_OF_PLAYERS || Game::MAX_NB_OF_PLAYERS < nbOfPlayers) {
+            throw std::invalid_argument(std::to_string(nbOfPlayers)
+                                        + " is not a valid number of player!");
+        }
+    }
+    if (!options_.playsSimplified && !options_.playsFull) {
+        throw std::invalid_argument("At least one set of rules is needed.");
+    }
+    if (options_.nbOfThreads == 0) {
+        options_.nbOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+/**
+ * @brief Gets every set of the given number of distinct entrants, in
+ * lexicographic order.
+ */
+static std::vector<std::vector<unsigned>> getCombinations(unsigned nbOfEntrants,
+                                                         unsigned nbOfPlayers)
+{
+    std::vector<std::vector<unsigned>> combinations;
+    std::vector<unsigned> combination(nbOfPlayers);
+    for (unsigned index = 0; index < nbOfPlayers; ++index) combination[index] = index;
+    while (true) {
+        combinations.push_back(combination);
+        int index = static_cast<int>(nbOfPlayers) - 1;
+        while (index >= 0 && combination[index] == nbOfEntrants - nbOfPlayers + index) --index;
+        if (index < 0) return combinations;
+        ++combination[index];
+        for (unsigned next = index + 1; next < nbOfPlayers; ++next) {
+            combination[next] = combination[next - 1] + 1;
+        }
+    }
+}
+
+/**
+ * @brief Ranks the entrants by their points in the given games, 1 per win and
+ * a share of 1 per draw. Ties keep the order of the entrants.
+ */
+static std::vector<unsigned> rankEntrants(unsigned nbOfEntrants,
+                                          const std::vector<TournamentGame> &games)
+{
+    std::vector<double> points(nbOfEntrants, 0);
+    for (const TournamentGame &game : games) {
+        if (game.winner < game.players.size()) {
+            points[game.players[game.winner]] += 1;
+        } else {
+            for (unsigned player : game.players) points[player] += 1.0 / game.players.size();
+        }
+    }
+    std::vector<unsigned> ranking(nbOfEntrants);
+    for (unsigned index = 0; index < nbOfEntrants; ++index) ranking[index] = index;
+    std::stable_sort(ranking.begin(), ranking.end(), [&](unsigned lhs, unsigned rhs) {
+        return points[lhs] > points[rhs];
+    });
+    return ranking;
+}
+
+std::size_t Tournament::drawRound(unsigned round, std::vector<TournamentGame> &games) const
+{
+    const std::size_t first = games.size();
+    const unsigned nbOfEntrants = static_cast<unsigned>(options_.entrants.size());
+    std::vector<unsigned> ranking = rankEntrants(nbOfEntrants, games);
+    std::vector<bool> rules;
+    if (options_.playsSimplified) rules.push_back(true);
+    if (options_.playsFull) rules.push_back(false);
+    for (unsigned nbOfPlayers : options_.nbOfPlayers) {
+        if (nbOfPlayers > nbOfEntrants) continue;
+        std::vector<std::vector<unsigned>> tables;
+        if (options_.format == TournamentOptions::Format::ROUND_ROBIN) {
+            tables = getCombinations(nbOfEntrants, nbOfPlayers);
+        } else {
+            for (unsigned seat = 0; seat + nbOfPlayers <= nbOfEntrants; seat += nbOfPlayers) {
+                tables.emplace_back(ranking.begin() + seat,
+                                    ranking.begin() + seat + nbOfPlayers);
+            }
+        }
+        for (const std::vector<unsigned> &table : tables) {
+            for (bool isSimplified : rules) {
+                for (unsigned rotation = 0; rotation < nbOfPlayers; ++rotation) {
+                    TournamentGame game;
+                    game.round = round;
+                    game.isSimplified = isSimplified;
+                    game.seed = options_.seed + static_cast<unsigned>(games.size());
+                    for (unsigned seat = 0; seat < nbOfPlayers; ++seat) {
+                        game.players.push_back(table[(seat + rotation) % nbOfPlayers]);
+                    }
+                    game.winner = nbOfPlayers;
+                    game.nbOfTurns = 0;
+                    games.push_back(game);
+                }
+            }
+        }
+    }
+    return first;
+}
+
+void Tournament::playGame(TournamentGame &result) const
+{
+    const unsigned nbOfPlayers = static_cast<unsigned>(result.players.size());
+    Game game{nbOfPlayers, result.isSimplified, result.seed};
+    RandomEngine seeds{result.seed};
+    std::vector<std::unique_ptr<Policy>> policies;
+    for (unsigned player : result.players) {
+        policies.push_back(PolicyFactory::getPolicy(options_.entrants.at(player),
+                                                    static_cast<unsigned>(seeds())));
+    }
+    result.nbOfTurns = 0;
+    while (!game.isOver() && result.nbOfTurns < options_.maxNbOfTurns) {
+        game.playTurn(policies.at(game.getCurrentPlayerIndex())->chooseTurn(game));
+        ++result.nbOfTurns;
+    }
+    result.winner = nbOfPlayers;
+    if (!game.isOver()) return;
+    Player::Color winner = game.getWinner().getColor();
+    for (unsigned player = 0; player < nbOfPlayers; ++player) {
+        if (game.getPlayer(player).getColor() == winner) result.winner = player;
+    }
+}
+
+/**
+ * @brief Opens the given CSV file and writes its header line.
+ */
+static void openCsv(std::ofstream &file, const std::string &path, const char *header)
+{
+    file.open(path);
+    if (!file) throw std::runtime_error("Cannot write " + path + ".");
+    file << header << '\n';
+}
+
+TournamentReport Tournament::run() const
+{
+    TournamentReport report;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned round = 0; round < options_.nbOfRounds; ++round) {
+        std::size_t first = drawRound(round, report.games);
+        std::atomic<std::size_t> next{first};
+        std::mutex mutex;
+        std::exception_ptr error;
+        auto work = [&]() {
+            try {
+                for (std::size_t index = next++; index < report.games.size(); index = next++) {
+                    playGame(report.games[index]);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{mutex};
+                if (!error) error = std::current_exception();
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned thread = 1; thread < options_.nbOfThreads; ++thread) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+        if (error) std::rethrow_exception(error);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    report.seconds = elapsed.count();
+
+    EloRatings ratings{options_.entrants};
+    for (const TournamentGame &game : report.games) {
+        ratings.addGame(game.players, game.winner);
+    }
+    report.ratings = ratings.compute();
+
+    if (!options_.gamesPath.empty()) {
+        std::ofstream file;
+        openCsv(file, options_.gamesPath, "game,round,players,rules,seed,seats,winner,turns");
+        for (std::size_t index = 0; index < report.games.size(); ++index) {
+            const TournamentGame &game = report.games[index];
+            file << index << ',' << game.round << ',' << game.players.size() << ','
+                 << (game.isSimplified ? "simplified" : "full") << ',' << game.seed << ',';
+            for (unsigned seat = 0; seat < game.players.size(); ++seat) {
+                file << (seat > 0 ? ";" : "") << options_.entrants[game.players[seat]];
+            }
+            file << ',' << (game.winner < game.players.size()
+                            ? options_.entrants[game.players[game.winner]] : "")
+                 << ',' << game.nbOfTurns << '\n';
+        }
+        if (!file.flush()) throw std::runtime_error("Cannot write " + options_.gamesPath + ".");
+    }
+    if (!options_.ratingsPath.empty()) {
+        std::ofstream file;
+        openCsv(file, options_.ratingsPath, "entrant,games,wins,draws,elo,elo_low,elo_high");
+        file << std::fixed << std::setprecision(1);
+        for (const Rating &rating : report.ratings) {
+            file << rating.entrant << ',' << rating.nbOfGames << ',' << rating.nbOfWins << ','
+                 << rating.nbOfDraws << ',' << rating.elo << ','
+                 << rating.elo - rating.margin << ',' << rating.elo + rating.margin << '\n';
+        }
+        if (!file.flush()) throw std::runtime_error("Cannot write " + options_.ratingsPath + ".");
+    }
+    return report;
+}
+
+}}
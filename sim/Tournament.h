@@ -0,0 +1,222 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <string>
+#include <vector>
+
+#include "EloRatings.h"
+
+namespace labyrinth { namespace sim {
+
+/**
+ * @brief Are the settings of a tournament between automated policies.
+ */
+struct TournamentOptions
+{
+
+    /**
+     * @brief Tells how the tables of a round are drawn.
+     */
+    enum class Format
+    {
+        /**
+         * @brief Every round, every set of distinct entrants of each number
+         * of players sits at a table.
+         */
+        ROUND_ROBIN,
+
+        /**
+         * @brief Every round, the entrants are ranked by their points so far
+         * and sit at tables with their neighbors in the ranking, whether or
+         * not they already met. The entrants left over at the bottom of the
+         * ranking sit out the round.
+         */
+        SWISS
+    };
+
+    /**
+     * @brief Are the names of the policies taking part, all different.
+     */
+    std::vector<std::string> entrants{"greedy", "search"};
+
+    /**
+     * @brief Is the way the tables are drawn.
+     */
+    Format format = Format::ROUND_ROBIN;
+
+    /**
+     * @brief Is the number of rounds.
+     */
+    unsigned nbOfRounds = 10;
+
+    /**
+     * @brief Are the numbers of players of the tables. The numbers above the
+     * number of entrants are skipped.
+     */
+    std::vector<unsigned> nbOfPlayers{2, 3, 4};
+
+    /**
+     * @brief Tells if the tables play the simplified rules.
+     */
+    bool playsSimplified = true;
+
+    /**
+     * @brief Tells if the tables play the full rules.
+     */
+    bool playsFull = true;
+
+    /**
+     * @brief Is the number of worker threads, 0 for one per core.
+     */
+    unsigned nbOfThreads = 0;
+
+    /**
+     * @brief Is the number of turns after which a game is declared a draw.
+     */
+    unsigned maxNbOfTurns = 2000;
+
+    /**
+     * @brief Is the seed of the first game. The game of index i is set up from
+     * the seed seed + i, and so are the random engines of its policies.
+     */
+    unsigned seed = 1;
+
+    /**
+     * @brief Is the CSV file the result of each game is written to, empty to
+     * not write it.
+     */
+    std::string gamesPath;
+
+    /**
+     * @brief Is the CSV file the ratings are written to, empty to not write
+     * them.
+     */
+    std::string ratingsPath;
+
+};
+
+/**
+ * @brief Is the result of a game of a tournament.
+ */
+struct TournamentGame
+{
+
+    /**
+     * @brief Is the index of the round of the game.
+     */
+    unsigned round;
+
+    /**
+     * @brief Tells if the game is simplified.
+     */
+    bool isSimplified;
+
+    /**
+     * @brief Is the seed the game was set up from.
+     */
+    unsigned seed;
+
+    /**
+     * @brief Are the indices of the entrants, one per seat.
+     */
+    std::vector<unsigned> players;
+
+    /**
+     * @brief Is the seat of the winner, players.size() for a draw.
+     */
+    unsigned winner;
+
+    /**
+     * @brief Is the number of turns played.
+     */
+    unsigned nbOfTurns;
+
+};
+
+/**
+ * @brief Are the results of a tournament.
+ */
+struct TournamentReport
+{
+
+    /**
+     * @brief Are the games played, in the order they were drawn.
+     */
+    std::vector<TournamentGame> games;
+
+    /**
+     * @brief Are the ratings of the entrants, in their order in the options.
+     */
+    std::vector<Rating> ratings;
+
+    /**
+     * @brief Is the wall clock duration of the tournament, in seconds.
+     */
+    double seconds = 0;
+
+};
+
+/**
+ * @brief Plays rounds of games between automated policies and estimates their
+ * Elo ratings (see EloRatings).
+ *
+ * Each table of a round is played once per rotation of its seats and per
+ * set of rules, so no entrant gets the first move more often than the others.
+ * The games of a round are spread over worker threads, each thread playing a
+ * whole game at a time. Their results are kept in the order they were drawn,
+ * so a tournament does not depend on the number of threads.
+ */
+class Tournament
+{
+
+    /**
+     * @brief Are the settings of the tournament.
+     */
+    TournamentOptions options_;
+
+public:
+
+    /**
+     * @brief Constructs this tournament.
+     *
+     * @param options are the settings of the tournament.
+     * @throws std::invalid_argument if an entrant is unknown or taking part
+     * twice, a number of players is not valid, there are less than 2 entrants
+     * or no rules are played.
+     */
+    explicit Tournament(const TournamentOptions &options);
+
+    /**
+     * @brief Plays all the rounds, writes the CSV files and estimates the
+     * ratings.
+     *
+     * @return the results of the tournament.
+     * @throws std::runtime_error if a CSV file cannot be written.
+     */
+    TournamentReport run() const;
+
+private:
+
+    /**
+     * @brief Draws the games of a round. The seeds are the ones following the
+     * games already drawn.
+     *
+     * @param round is the index of the round.
+     * @param games are the games already played, appended with the new ones.
+     * @return the index of the first new game.
+     */
+    std::size_t drawRound(unsigned round, std::vector<TournamentGame> &games) const;
+
+    /**
+     * @brief Plays the given game until it is over or the maximum number of
+     * turns is reached, and sets its winner and number of turns.
+     *
+     * @param result is the game to play.
+     */
+    void playGame(TournamentGame &result) const;
+
+};
+
+}}
+
+#endif // TOURNAMENT_H
@@ -0,0 +1,53 @@
+include(../defaults.pri)
+
+TEMPLATE = app
+TARGET = labyrinth-sim
+CONFIG += console thread
+CONFIG -= qt
+
+SOURCES += \
+    Main.cpp \
+    Simulator.cpp \
+    Tournament.cpp \
+    EloRatings.cpp \
+    ../core/bot/RandomPolicy.cpp \
+    ../core/bot/GreedyPolicy.cpp \
+    ../core/bot/Evaluator.cpp \
+    ../core/bot/TurnSearcher.cpp \
+    ../core/bot/MctsPolicy.cpp \
+    ../core/bot/WorkStealingPool.cpp \
+    ../core/model/DistanceField.cpp \
+    ../core/model/Game.cpp \
+    ../core/model/GameRecord.cpp \
+    ../core/model/GameState.cpp \
+    ../core/model/Maze.cpp \
+    ../core/model/MoveGenerator.cpp \
+    ../core/model/MazeBitboard.cpp \
+    ../core/model/MazeCell.cpp \
+    ../core/model/MazeCard.cpp \
+    ../core/model/MazeCardsBuilder.cpp \
+    ../core/model/MazeCardShape.cpp \
+    ../core/model/MazePosition.cpp \
+    ../core/model/ObjectivesDeck.cpp \
+    ../core/model/Zobrist.cpp \
+    ../core/observer/Subject.cpp
+
+HEADERS += \
+    Simulator.h \
+    Tournament.h \
+    EloRatings.h \
+    ../core/bot/Policy.h \
+    ../core/bot/PolicyFactory.h \
+    ../core/bot/RandomPolicy.h \
+    ../core/bot/GreedyPolicy.h \
+    ../core/bot/Evaluator.h \
+    ../core/bot/TurnSearcher.h \
+    ../core/bot/MctsPolicy.h \
+    ../core/bot/WorkStealingPool.h
+
+DESTDIR = $$PWD/../build
+
+INCLUDEPATH += \
+    $$PWD \
+    ../core/model \
+    ../core/bot
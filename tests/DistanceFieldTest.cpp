@@ -0,0 +1,117 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "DistanceField.h"
+#include "Game.h"
+#include "Maze.h"
+#endif
+
+#include <deque>
+
+using namespace labyrinth::model;
+
+/**
+ * @brief Computes the distances from the given position by walking to the
+ * neighbors of the maze, one position at a time.
+ */
+static std::vector<unsigned> walkFrom(const Maze &maze, const MazePosition &from)
+{
+    std::vector<unsigned> distances(MazeBitboard::CELLS, DistanceField::UNREACHABLE);
+    std::deque<MazePosition> positions{from};
+    distances[MazeBitboard::getCell(from)] = 0;
+    while (!positions.empty()) {
+        MazePosition position = positions.front();
+        positions.pop_front();
+        for (const MazePosition &neighbor : maze.getNeighbors(position)) {
+            unsigned &distance = distances[MazeBitboard::getCell(neighbor)];
+            if (distance == DistanceField::UNREACHABLE) {
+                distance = distances[MazeBitboard::getCell(position)] + 1;
+                positions.push_back(neighbor);
+            }
+        }
+    }
+    return distances;
+}
+
+TEST_CASE("A new field reaches no cell")
+{
+    DistanceField field;
+    CHECK(field.getReachable() == 0);
+    CHECK(field.getDistance(0u) == DistanceField::UNREACHABLE);
+    CHECK(field.getMinDistance(MazeBitboard::ALL) == DistanceField::UNREACHABLE);
+}
+
+TEST_CASE("The distances follow the pathways and mark the unreachable cells")
+{
+    MazeBitboard board;
+    board.setShape(MazeBitboard::getCell({0, 0}), RIGHT);
+    board.setShape(MazeBitboard::getCell({0, 1}), LEFT | DOWN);
+    board.setShape(MazeBitboard::getCell({1, 1}), UP | RIGHT);
+    board.setShape(MazeBitboard::getCell({1, 2}), LEFT);
+    DistanceField field;
+    field.compute(board, MazeBitboard::getBit(MazeBitboard::getCell({0, 0})));
+    CHECK(field.getDistance(MazePosition{0, 0}) == 0);
+    CHECK(field.getDistance(MazePosition{0, 1}) == 1);
+    CHECK(field.getDistance(MazePosition{1, 1}) == 2);
+    CHECK(field.getDistance(MazePosition{1, 2}) == 3);
+    CHECK(field.getDistance(MazePosition{1, 0}) == DistanceField::UNREACHABLE);
+    CHECK(field.isReachable(MazePosition{1, 2}));
+    CHECK_FALSE(field.isReachable(MazePosition{1, 0}));
+    CHECK(field.getMinDistance(MazeBitboard::getBit(MazeBitboard::getCell({1, 1}))
+                               | MazeBitboard::getBit(MazeBitboard::getCell({1, 2}))) == 2);
+}
+
+TEST_CASE("Many sources give the distance to the nearest one")
+{
+    MazeBitboard board;
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        board.setShape(cell, UP | RIGHT | DOWN | LEFT);
+    }
+    const unsigned last = MazeBitboard::SIZE - 1;
+    DistanceField field;
+    field.compute(board, MazeBitboard::getBit(MazeBitboard::getCell({0, 0}))
+                  | MazeBitboard::getBit(MazeBitboard::getCell({last, last})));
+    CHECK(field.getReachable() == MazeBitboard::ALL);
+    CHECK(field.getDistance(MazePosition{0, last}) == last);
+    CHECK(field.getDistance(MazePosition{1, 1}) == 2);
+    CHECK(field.getDistance(MazePosition{last - 1, last}) == 1);
+}
+
+TEST_CASE("The distances of a maze are the ones of a walk over its neighbors")
+{
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        RandomEngine engine{seed};
+        Maze maze{engine};
+        MazePosition from = MazeBitboard::getPosition(seed * 7 % MazeBitboard::CELLS);
+        DistanceField field;
+        maze.computeDistancesFrom(from, field);
+        std::vector<unsigned> expected = walkFrom(maze, from);
+        for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+            REQUIRE(field.getDistance(cell) == expected[cell]);
+        }
+        REQUIRE(field.getReachable() == maze.reachableFrom(from).getCells());
+    }
+}
+
+TEST_CASE("The fields of the players are the ones from their positions")
+{
+    Game game{4, false, 8u};
+    DistanceField fields[4];
+    game.computePlayerDistances(fields);
+    for (unsigned index = 0; index < game.getNbOfPlayers(); ++index) {
+        DistanceField expected;
+        game.getMaze().computeDistancesFrom(game.getPlayer(index).getPosition(), expected);
+        for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+            REQUIRE(fields[index].getDistance(cell) == expected.getDistance(cell));
+        }
+        CHECK(fields[index].getDistance(game.getPlayer(index).getPosition()) == 0);
+    }
+}
+
+TEST_CASE("The distances cannot be computed from outside of the maze")
+{
+    Maze maze;
+    DistanceField field;
+    REQUIRE_THROWS_AS(maze.computeDistancesFrom(MazePosition{MazeBitboard::SIZE, 0}, field),
+                      std::invalid_argument);
+}
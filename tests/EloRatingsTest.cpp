@@ -0,0 +1,125 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#endif
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "EloRatings.h"
+
+using namespace labyrinth::sim;
+
+/**
+ * @brief Adds the given number of duels won by the first entrant against the
+ * second one.
+ */
+static void addWins(EloRatings &ratings, unsigned winner, unsigned loser, unsigned nbOfWins)
+{
+    for (unsigned game = 0; game < nbOfWins; ++game) {
+        ratings.addGame({winner, loser}, 0);
+    }
+}
+
+TEST_CASE("Two entrants are rated from their wins with the virtual draw")
+{
+    EloRatings elo{{"first", "second"}};
+    addWins(elo, 0, 1, 3);
+    addWins(elo, 1, 0, 1);
+    std::vector<Rating> ratings = elo.compute();
+    REQUIRE(ratings.size() == 2);
+    CHECK(ratings[0].entrant == "first");
+    CHECK(ratings[0].nbOfGames == 4);
+    CHECK(ratings[0].nbOfWins == 3);
+    CHECK(ratings[1].nbOfWins == 1);
+
+    // With the virtual draw, the first entrant scores 3.5 of 5 duels: his/ her
+    // strength is 3.5 / 1.5 times the one of the second entrant.
+    double difference = 400 * std::log10(3.5 / 1.5);
+    CHECK(ratings[0].elo == Approx(1500 + difference / 2));
+    CHECK(ratings[1].elo == Approx(1500 - difference / 2));
+    double margin = 1.96 * 400 / std::log(10.0) / std::sqrt(5 * 0.7 * 0.3);
+    CHECK(ratings[0].margin == Approx(margin));
+    CHECK(ratings[1].margin == Approx(margin));
+}
+
+TEST_CASE("The ratings follow the duels won and average 1500")
+{
+    EloRatings elo{{"weak", "strong", "medium"}};
+    addWins(elo, 1, 2, 30);
+    addWins(elo, 2, 1, 10);
+    addWins(elo, 2, 0, 30);
+    addWins(elo, 0, 2, 10);
+    addWins(elo, 1, 0, 35);
+    addWins(elo, 0, 1, 5);
+    std::vector<Rating> ratings = elo.compute();
+    CHECK(ratings[1].elo > ratings[2].elo);
+    CHECK(ratings[2].elo > ratings[0].elo);
+    CHECK((ratings[0].elo + ratings[1].elo + ratings[2].elo) / 3 == Approx(1500));
+    // Winning 3 duels out of 4 is worth about 190 points.
+    CHECK(ratings[1].elo - ratings[2].elo == Approx(190).margin(40));
+    CHECK(ratings[2].elo - ratings[0].elo == Approx(190).margin(40));
+    for (const Rating &rating : ratings) {
+        CHECK(rating.nbOfGames == 80);
+        CHECK(rating.margin > 0);
+        CHECK(rating.margin < 100);
+    }
+}
+
+TEST_CASE("The confidence interval narrows with the number of games")
+{
+    EloRatings elo{{"first", "second"}};
+    addWins(elo, 0, 1, 6);
+    addWins(elo, 1, 0, 4);
+    double margin = elo.compute()[0].margin;
+    addWins(elo, 0, 1, 54);
+    addWins(elo, 1, 0, 36);
+    std::vector<Rating> ratings = elo.compute();
+    CHECK(ratings[0].margin < margin / 2);
+    CHECK(ratings[0].elo > ratings[1].elo);
+}
+
+TEST_CASE("The winner of a game of many players beats each of the others")
+{
+    EloRatings elo{{"first", "second", "third"}};
+    elo.addGame({2, 0, 1}, 0);
+    elo.addGame({0, 1, 2}, 2);
+    std::vector<Rating> ratings = elo.compute();
+    CHECK(ratings[2].nbOfWins == 2);
+    CHECK(ratings[0].nbOfWins == 0);
+    CHECK(ratings[2].elo > ratings[0].elo);
+    CHECK(ratings[0].elo == Approx(ratings[1].elo));
+}
+
+TEST_CASE("The players of a draw all draw against each other")
+{
+    EloRatings elo{{"first", "second", "third"}};
+    elo.addGame({0, 1, 2}, 3);
+    elo.addGame({1, 2}, 2);
+    std::vector<Rating> ratings = elo.compute();
+    CHECK(ratings[0].nbOfDraws == 1);
+    CHECK(ratings[1].nbOfDraws == 2);
+    CHECK(ratings[2].nbOfGames == 2);
+    for (const Rating &rating : ratings) {
+        CHECK(rating.nbOfWins == 0);
+        CHECK(rating.elo == Approx(1500));
+    }
+
+    addWins(elo, 0, 1, 1);
+    ratings = elo.compute();
+    double withoutDraws = ratings[0].elo - ratings[1].elo;
+    for (unsigned game = 0; game < 20; ++game) elo.addGame({0, 1}, 2);
+    ratings = elo.compute();
+    CHECK(ratings[0].elo - ratings[1].elo < withoutDraws);
+    CHECK(ratings[0].elo > ratings[1].elo);
+}
+
+TEST_CASE("A game with an unknown entrant or winner is rejected")
+{
+    EloRatings elo{{"first", "second"}};
+    REQUIRE_THROWS_AS(elo.addGame({0, 2}, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(elo.addGame({0, 1}, 3), std::invalid_argument);
+    CHECK(elo.compute()[0].nbOfGames == 0);
+}
@@ -0,0 +1,104 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "DistanceField.h"
+#include "Evaluator.h"
+#include "Game.h"
+#include "GreedyPolicy.h"
+#include "MoveGenerator.h"
+#endif
+
+#include <vector>
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+/**
+ * @brief Checks that the batch scores of the turns of the given game are the
+ * ones of the games once the turns are applied, for every player.
+ */
+static void requireBatchScores(Game &game, const Evaluator &evaluator)
+{
+    MoveGenerator generator{game};
+    std::vector<int> scores;
+    for (unsigned player = 0; player < game.getNbOfPlayers(); ++player) {
+        evaluator.evaluate(game, generator, player, scores);
+        REQUIRE(scores.size() == generator.getMoves().size());
+        for (unsigned index = 0; index < scores.size(); ++index) {
+            TurnRecord record = game.applyTurn(generator.getMoves()[index].turn);
+            int expected = evaluator.evaluate(game, player);
+            game.undoTurn(record);
+            REQUIRE(scores[index] == expected);
+        }
+    }
+}
+
+TEST_CASE("The batch scores are the ones of the applied turns")
+{
+    EvaluationWeights weights;
+    weights.mobility = 1;
+    const Evaluator evaluators[] = {Evaluator{}, Evaluator{weights}};
+    for (unsigned seed = 0; seed < 6; ++seed) {
+        Game game{2 + seed % 3, seed % 2 == 0, seed};
+        GreedyPolicy policy{seed};
+        for (unsigned turn = 0; turn < 12 && !game.isOver(); ++turn) {
+            for (const Evaluator &evaluator : evaluators) {
+                requireBatchScores(game, evaluator);
+            }
+            game.applyTurn(policy.chooseTurn(game));
+        }
+    }
+}
+
+TEST_CASE("The features of a player follow the walks of the maze")
+{
+    Game game{2, false, 3u};
+    const Player &player = game.getPlayer(0);
+    PlayerFeatures features = Evaluator::getFeatures(game, 0);
+    CHECK(features.nbOfRemainingObjectives == player.getObjectives().getNbOfCards());
+    CHECK(features.mobility == game.getMaze().reachableFrom(player.getPosition()).size());
+    CHECK(features.targetDistance <= Evaluator::MAX_DISTANCE);
+    CHECK_FALSE(features.hasWon);
+    if (game.getMaze().isInside(player.getObjective())) {
+        DistanceField field;
+        game.getMaze().computeDistancesFrom(player.getPosition(), field);
+        unsigned walk = field.getDistance(game.getMaze().getObjectPosition(player.getObjective()));
+        CHECK(features.targetDistance <= walk);
+    } else {
+        CHECK(features.targetDistance == Evaluator::MAX_DISTANCE);
+    }
+}
+
+TEST_CASE("A won game is scored as won whatever the weights")
+{
+    Game game{3, true, 2u};
+    game.getCurrentPlayer().turnAllObjectivesOver();
+    EvaluationWeights weights;
+    weights.opponents = 0;
+    for (const Evaluator &evaluator : {Evaluator{}, Evaluator{weights}}) {
+        CHECK(evaluator.evaluate(game, 0) == Evaluator::WIN);
+        CHECK(evaluator.evaluate(game, 1) == -Evaluator::WIN);
+        CHECK(evaluator.evaluate(game, 2) == -Evaluator::WIN);
+    }
+    CHECK(Evaluator::getFeatures(game, 0).hasWon);
+}
+
+TEST_CASE("The weights scale the features")
+{
+    Game game{2, false, 4u};
+    PlayerFeatures own = Evaluator::getFeatures(game, 0);
+    PlayerFeatures other = Evaluator::getFeatures(game, 1);
+    EvaluationWeights weights;
+    weights.objective = 0;
+    weights.distance = 0;
+    weights.mobility = 1;
+    weights.opponents = 0;
+    CHECK(Evaluator{weights}.evaluate(game, 0) == static_cast<int>(own.mobility));
+    weights.opponents = 2;
+    CHECK(Evaluator{weights}.evaluate(game, 0)
+          == static_cast<int>(own.mobility) - 2 * static_cast<int>(other.mobility));
+    weights.mobility = 0;
+    weights.distance = 1;
+    weights.opponents = 0;
+    CHECK(Evaluator{weights}.evaluate(game, 0) == -static_cast<int>(own.targetDistance));
+}
@@ -0,0 +1,151 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Frame.h"
+#endif
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace labyrinth::view;
+
+/**
+ * @brief Plays the given text on a console of the given rows, interpreting the
+ * cursor moves and the erasures of the end of a row.
+ */
+static void playOnConsole(std::vector<std::string> &console, const std::string &text)
+{
+    std::size_t row = 0;
+    std::size_t column = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '\x1b') {
+            std::size_t end = text.find_first_of("HK", i);
+            if (text[end] == 'H') {
+                std::size_t separator = text.find(';', i);
+                row = std::strtoul(text.c_str() + i + 2, nullptr, 10) - 1;
+                column = std::strtoul(text.c_str() + separator + 1, nullptr, 10) - 1;
+            } else {
+                console[row].resize(column);
+            }
+            i = end;
+        } else if (text[i] == '\n') {
+            ++row;
+            column = 0;
+        } else {
+            if (console[row].size() <= column) console[row].resize(column + 1, ' ');
+            console[row][column++] = text[i];
+        }
+    }
+}
+
+TEST_CASE("A new frame prints empty rows") {
+    Frame frame{3, 10};
+    std::string text;
+    frame.appendTo(text);
+    REQUIRE(text == "\n\n\n");
+}
+
+TEST_CASE("A frame prints each row up to its last drawn character") {
+    Frame frame{2, 10};
+    frame.put(0, 2, "ab");
+    frame.put(1, 0, '+');
+    frame.put(0, 0, 'x');
+    std::string text;
+    frame.appendTo(text);
+    REQUIRE(text == "x ab\n+\n");
+    REQUIRE(frame.getLength(0) == 4);
+    REQUIRE(frame.getAt(0, 1) == ' ');
+}
+
+TEST_CASE("Clearing a frame erases every row") {
+    Frame frame{2, 10};
+    frame.put(0, 0, "abc");
+    frame.clear();
+    std::string text;
+    frame.appendTo(text);
+    REQUIRE(text == "\n\n");
+    REQUIRE(frame.getAt(0, 0) == ' ');
+}
+
+TEST_CASE("Drawing outside of a frame throws") {
+    Frame frame{2, 4};
+    REQUIRE_THROWS_AS(frame.put(2, 0, 'a'), std::out_of_range);
+    REQUIRE_THROWS_AS(frame.put(0, 4, 'a'), std::out_of_range);
+    REQUIRE_THROWS_AS(frame.put(0, 2, "abc"), std::out_of_range);
+    REQUIRE_NOTHROW(frame.put(0, 2, "ab"));
+}
+
+TEST_CASE("An unchanged frame has no change") {
+    Frame previous{2, 10};
+    previous.put(0, 0, "abc");
+    Frame frame{2, 10};
+    frame.put(0, 0, "abc");
+    std::string text;
+    frame.appendChangesTo(previous, 1, text);
+    REQUIRE(text.empty());
+}
+
+TEST_CASE("The changes of a frame only redraw the changed characters") {
+    Frame previous{2, 40};
+    previous.put(0, 0, "+---+                              +---+");
+    previous.put(1, 0, "| r |");
+    Frame frame{2, 40};
+    frame.put(0, 0, "+---+                              +   +");
+    frame.put(1, 0, "| r |");
+    std::string text;
+    frame.appendChangesTo(previous, 5, text);
+    REQUIRE(text == "\x1b[5;37H   ");
+}
+
+TEST_CASE("Close changes of a row are redrawn together") {
+    Frame previous{1, 10};
+    previous.put(0, 0, "abcdef");
+    Frame frame{1, 10};
+    frame.put(0, 0, "xbcdey");
+    std::string text;
+    frame.appendChangesTo(previous, 1, text);
+    REQUIRE(text == "\x1b[1;1Hxbcdey");
+}
+
+TEST_CASE("A shorter row erases the end of the previous one") {
+    Frame previous{1, 10};
+    previous.put(0, 0, "abc <");
+    Frame frame{1, 10};
+    frame.put(0, 0, "abc");
+    std::string text;
+    frame.appendChangesTo(previous, 1, text);
+    REQUIRE(text == "\x1b[1;4H\x1b[K");
+}
+
+TEST_CASE("Playing the changes of a frame over the previous one prints it") {
+    Frame previous{3, 20};
+    previous.put(0, 0, "  0    1    2");
+    previous.put(1, 0, "+---++   ++---+ <");
+    previous.put(2, 4, "| rb |");
+    Frame frame{3, 20};
+    frame.put(0, 0, "  0    1    2");
+    frame.put(1, 0, "+   ++---++---+");
+    frame.put(2, 2, "y");
+    frame.put(2, 9, "| b  |");
+
+    std::string text;
+    previous.appendTo(text);
+    std::vector<std::string> console(3);
+    playOnConsole(console, text);
+    text.clear();
+    frame.appendChangesTo(previous, 1, text);
+    playOnConsole(console, text);
+
+    text.clear();
+    frame.appendTo(text);
+    REQUIRE(console[0] + "\n" + console[1] + "\n" + console[2] + "\n" == text);
+}
+
+TEST_CASE("Frames of different sizes cannot be compared") {
+    Frame previous{2, 10};
+    Frame frame{3, 10};
+    std::string text;
+    REQUIRE_THROWS_AS(frame.appendChangesTo(previous, 1, text), std::invalid_argument);
+}
@@ -0,0 +1,189 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "GameRecord.h"
+#include "GreedyPolicy.h"
+#endif
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+/**
+ * @brief Plays the given number of turns with a greedy policy and records
+ * them.
+ */
+static void playAndRecord(Game &game, GameRecord &record, unsigned nbOfTurns)
+{
+    GreedyPolicy policy{3};
+    for (unsigned turn = 0; turn < nbOfTurns && !game.isOver(); ++turn) {
+        Turn chosen = policy.chooseTurn(game);
+        game.playTurn(chosen);
+        record.addTurn(chosen);
+    }
+    record.finish(game);
+}
+
+static const unsigned char *getBytes(const std::string &bytes)
+{
+    return reinterpret_cast<const unsigned char *>(bytes.data());
+}
+
+TEST_CASE("Every turn is encoded on 2 bytes and decoded back")
+{
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        for (unsigned rotation = 0; rotation < 4; ++rotation) {
+            for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+                Turn turn{slot, rotation, MazeBitboard::getPosition(cell)};
+                REQUIRE(GameRecord::decodeTurn(GameRecord::encodeTurn(turn)) == turn);
+            }
+        }
+    }
+}
+
+TEST_CASE("A turn that is not an insertion slot and a cell cannot be recorded")
+{
+    REQUIRE_THROWS_AS(GameRecord::encodeTurn(Turn{MazePosition{1, 1}, 0, MazePosition{0, 0}}),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(GameRecord::encodeTurn(Turn{MazePosition{0, 1}, 0,
+                                                  MazePosition{Maze::SIZE, 0}}),
+                      std::invalid_argument);
+    // Every code of a slot is used when the number of slots is a power of 2.
+    if (Maze::NB_OF_SLOTS & (Maze::NB_OF_SLOTS - 1)) {
+        REQUIRE_THROWS_AS(GameRecord::decodeTurn(Maze::NB_OF_SLOTS), std::invalid_argument);
+    }
+    // The first slot and no rotation are encoded as 0, so the code of the cell
+    // 1 times the number of cells is the code of the first cell past the maze.
+    std::uint16_t cell1 = GameRecord::encodeTurn(Turn{Maze::getInsertionSlots()[0], 0,
+                                                      MazeBitboard::getPosition(1)});
+    REQUIRE_THROWS_AS(GameRecord::decodeTurn(static_cast<std::uint16_t>(cell1 * MazeBitboard::CELLS)),
+                      std::invalid_argument);
+}
+
+TEST_CASE("A seeded game is recorded on 16 bytes plus 2 bytes per turn")
+{
+    Game game{3, true, 11u};
+    GameRecord record{3, true, 11u};
+    playAndRecord(game, record, 20);
+    std::string bytes;
+    record.writeTo(bytes);
+    REQUIRE(bytes.size() == GameRecord::HEADER_SIZE + 2 * record.getTurns().size());
+
+    GameRecord read;
+    const unsigned char *data = getBytes(bytes);
+    read.readFrom(data, data + bytes.size());
+    REQUIRE(data == getBytes(bytes) + bytes.size());
+    REQUIRE(read.getSeed() == 11u);
+    REQUIRE(read.getNbOfPlayers() == 3);
+    REQUIRE(read.isSimplified());
+    REQUIRE_FALSE(read.hasLayout());
+    REQUIRE(read.getTurns() == record.getTurns());
+    REQUIRE(read.getFinalKey() == game.getKey());
+    REQUIRE(read.isOver() == game.isOver());
+}
+
+TEST_CASE("Replaying a record gives back the recorded game")
+{
+    Game game{2, false, 5u};
+    GameRecord record{2, false, 5u};
+    playAndRecord(game, record, 30);
+
+    Game replayed = record.createGame();
+    for (const Turn &turn : record.getTurns()) {
+        replayed.applyTurn(turn);
+    }
+    REQUIRE(replayed.getKey() == record.getFinalKey());
+}
+
+TEST_CASE("A game started from a layout keeps its layout in its record")
+{
+    Game game{4, false, 2u};
+    GameRecord record{GameState{game}};
+    playAndRecord(game, record, 10);
+    std::string bytes;
+    record.writeTo(bytes);
+    REQUIRE(bytes.size() == GameRecord::HEADER_SIZE + GameRecord::LAYOUT_SIZE
+            + 2 * record.getTurns().size());
+
+    GameRecord read;
+    const unsigned char *data = getBytes(bytes);
+    read.readFrom(data, data + bytes.size());
+    REQUIRE(read.hasLayout());
+    REQUIRE(read.getNbOfPlayers() == 4);
+    REQUIRE(read.getLayout() == record.getLayout());
+    REQUIRE(read.createGame().getKey() == Game(4, false, 2u).getKey());
+}
+
+TEST_CASE("The records of a file follow its header")
+{
+    std::string bytes;
+    GameRecord::writeFileHeader(bytes);
+    REQUIRE(bytes.size() == GameRecord::FILE_HEADER_SIZE);
+    GameRecord{2, false, 1u}.writeTo(bytes);
+    GameRecord{4, false, 2u}.writeTo(bytes);
+
+    const unsigned char *data = GameRecord::readFileHeader(getBytes(bytes), getBytes(bytes) + bytes.size());
+    const unsigned char *end = getBytes(bytes) + bytes.size();
+    REQUIRE(GameRecord::getSize(data, end) == GameRecord::HEADER_SIZE);
+    GameRecord record;
+    record.readFrom(data, end);
+    REQUIRE(record.getSeed() == 1u);
+    record.readFrom(data, end);
+    REQUIRE(record.getSeed() == 2u);
+    REQUIRE(data == end);
+}
+
+TEST_CASE("Malformed records are rejected")
+{
+    std::string bytes;
+    GameRecord record{2, false, 4u};
+    Game game{2, false, 4u};
+    playAndRecord(game, record, 3);
+    record.writeTo(bytes);
+    const unsigned char *end = getBytes(bytes) + bytes.size();
+
+    const unsigned char *data = getBytes(bytes);
+    REQUIRE_THROWS_AS(GameRecord{}.readFrom(data, end - 1), std::invalid_argument);
+    REQUIRE(data == getBytes(bytes));
+
+    REQUIRE_THROWS_AS(GameRecord::readFileHeader(getBytes(bytes), end), std::invalid_argument);
+    std::string header;
+    GameRecord::writeFileHeader(header);
+    header[4] = 2;
+    REQUIRE_THROWS_AS(GameRecord::readFileHeader(getBytes(header), getBytes(header) + header.size()),
+                      std::invalid_argument);
+    header[4] = 1;
+    header[5] = static_cast<char>(MazeBitboard::SIZE + 2);
+    REQUIRE_THROWS_AS(GameRecord::readFileHeader(getBytes(header), getBytes(header) + header.size()),
+                      std::invalid_argument);
+}
+
+TEST_CASE("A record whose layout is corrupted is rejected")
+{
+    const GameState valid{Game{3, true, 5u}};
+    std::vector<void (*)(GameState &)> corruptions{
+        [](GameState &layout) { layout.objects[0] = 200; },
+        [](GameState &layout) { layout.spareObject = NONE + 1; },
+        [](GameState &layout) { layout.blockedCell = MazeBitboard::CELLS; },
+        [](GameState &layout) { layout.selectedInsertionCell = 255; },
+        [](GameState &layout) { layout.playerCells[1] = 200; },
+        [](GameState &layout) { layout.currentPlayer = 3; },
+        [](GameState &layout) { layout.playerStates[0] = 7; },
+        [](GameState &layout) { layout.nbOfFoundObjectives[2] = 9; },
+        [](GameState &layout) { layout.objectives[0] = NONE; },
+    };
+    for (auto corrupt : corruptions) {
+        GameState layout = valid;
+        corrupt(layout);
+        std::string bytes;
+        GameRecord{layout}.writeTo(bytes);
+        GameRecord read;
+        const unsigned char *data = getBytes(bytes);
+        CHECK_THROWS_AS(read.readFrom(data, data + bytes.size()), std::invalid_argument);
+    }
+}
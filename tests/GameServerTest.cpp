@@ -0,0 +1,134 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#endif
+
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "GameServer.h"
+
+using namespace labyrinth::server;
+
+/**
+ * @brief Is a client of a game server, reading its replies up to the prompt.
+ */
+class TestClient
+{
+
+    int socket_;
+
+public:
+
+    explicit TestClient(unsigned short port)
+        : socket_{socket(AF_INET, SOCK_STREAM, 0)}
+    {
+        timeval timeout{5, 0};
+        setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (connect(socket_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+            throw std::runtime_error("Cannot connect to the server.");
+        }
+    }
+
+    ~TestClient() { close(socket_); }
+
+    void send(const std::string &text) {
+        ::send(socket_, text.data(), text.size(), 0);
+    }
+
+    /**
+     * @brief Reads until the given text is received or the server closes
+     * the connection.
+     */
+    std::string readUntil(const std::string &end) {
+        std::string text;
+        char buffer[1024];
+        while (text.find(end) == std::string::npos) {
+            ssize_t size = recv(socket_, buffer, sizeof(buffer), 0);
+            if (size <= 0) break;
+            text.append(buffer, static_cast<std::size_t>(size));
+        }
+        return text;
+    }
+
+};
+
+TEST_CASE("A game server plays one game per client") {
+    GameServer server{0, 2, 2, false};
+    REQUIRE(server.getPort() != 0);
+    std::thread thread{[&server] { server.run(); }};
+
+    {
+        TestClient first{server.getPort()};
+        TestClient second{server.getPort()};
+        REQUIRE(first.readUntil(" > ").find("Current mazecard...") != std::string::npos);
+        REQUIRE(second.readUntil(" > ").find("Current mazecard...") != std::string::npos);
+
+        first.send("rotate 1\nrotate");
+        first.send(" 2\n");
+        std::string text = first.readUntil("card 2.");
+        REQUIRE(text.find("You have rotated the current maze card 1.") != std::string::npos);
+        REQUIRE(text.find("You have rotated the current maze card 2.") != std::string::npos);
+
+        second.send("dance\n");
+        REQUIRE(second.readUntil(" > ").find("dance is not a command!") != std::string::npos);
+
+        second.send("exit\n");
+        REQUIRE(second.readUntil("\n\n") == "Bye!\n");
+    }
+    REQUIRE(server.getNbOfSessions() == 2);
+
+    server.stop();
+    thread.join();
+}
+
+TEST_CASE("A game server disconnects the clients sending too long lines") {
+    GameServer server{0, 1, 2, false};
+    std::thread thread{[&server] { server.run(); }};
+    {
+        TestClient client{server.getPort()};
+        client.readUntil(" > ");
+        client.send(std::string(GameServer::MAX_LINE_LENGTH + 1, 'x'));
+        REQUIRE(client.readUntil("\n").empty());
+    }
+    server.stop();
+    thread.join();
+}
+
+TEST_CASE("A game server executes every line a client pipelines") {
+    GameServer server{0, 1, 2, false};
+    std::thread thread{[&server] { server.run(); }};
+    {
+        TestClient client{server.getPort()};
+        client.readUntil(" > ");
+        const std::size_t nbOfLines = 20 * GameServer::MAX_NB_OF_QUEUED_LINES;
+        std::string lines;
+        for (std::size_t line = 0; line < nbOfLines; ++line) lines += "rotate 1\n";
+        client.send(lines + "rotate 3\n");
+        std::string text = client.readUntil("card 3.");
+        std::size_t nbOfReplies = 0;
+        for (std::size_t at = text.find("card 1."); at != std::string::npos;
+             at = text.find("card 1.", at + 1)) {
+            ++nbOfReplies;
+        }
+        REQUIRE(nbOfReplies == nbOfLines);
+    }
+    server.stop();
+    thread.join();
+}
+
+TEST_CASE("A game server checks its settings") {
+    REQUIRE_THROWS_AS((GameServer{0, 0, 2, false}), std::invalid_argument);
+    REQUIRE_THROWS_AS((GameServer{0, 1, 5, false}), std::invalid_argument);
+}
@@ -0,0 +1,138 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "GameState.h"
+#include "MoveGenerator.h"
+#endif
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+using namespace labyrinth::model;
+
+TEST_CASE("A game state is a small trivially copyable value")
+{
+    CHECK(std::is_trivially_copyable<GameState>::value);
+    CHECK(sizeof(GameState) <= MAX_GAME_STATE_SIZE);
+}
+
+TEST_CASE("The state of a new game restores the same game")
+{
+    for (unsigned nbOfPlayers = 2; nbOfPlayers <= 4; ++nbOfPlayers) {
+        Game g{nbOfPlayers, nbOfPlayers == 3, nbOfPlayers};
+        GameState state{g};
+        Game restored{state};
+        CHECK(restored.getNbOfPlayers() == nbOfPlayers);
+        CHECK(restored.isSimplified() == g.isSimplified());
+        CHECK(restored.getKey() == g.getKey());
+        CHECK(restored.getMaze().getPathways() == g.getMaze().getPathways());
+        CHECK(restored.getCurrentMazeCard().isEqualTo(g.getCurrentMazeCard()));
+        for (unsigned index = 0; index < nbOfPlayers; ++index) {
+            CHECK(restored.getPlayer(index).getPosition() == g.getPlayer(index).getPosition());
+            CHECK(restored.getPlayer(index).getObjective() == g.getPlayer(index).getObjective());
+        }
+        CHECK(GameState{restored} == state);
+    }
+}
+
+TEST_CASE("A state copied as plain memory restores the same game")
+{
+    Game g{4, false, 8u};
+    GameState state{g};
+    GameState copy;
+    std::memcpy(&copy, &state, sizeof(GameState));
+    CHECK(copy == state);
+    CHECK(Game{copy}.getKey() == g.getKey());
+}
+
+TEST_CASE("The conversion to and from a state is lossless during a game")
+{
+    unsigned nbOfFoundObjectives = 0;
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        Game g{2 + seed % 3, false, seed};
+        for (unsigned turn = 0; turn < 24; ++turn) {
+            MoveGenerator generator{g};
+            Object objective = g.getCurrentPlayer().getObjective();
+            const MoveGenerator::Move *found = nullptr;
+            for (const MoveGenerator::Move &move : generator.getMoves()) {
+                const Maze &maze = generator.getShiftOf(move).maze;
+                if (maze.isInside(objective)
+                        && maze.getObjectPosition(objective) == move.turn.destination) {
+                    found = &move;
+                }
+            }
+            const MoveGenerator::Move &move = found
+                    ? *found
+                    : generator.getMoves().at(turn * 13 % generator.getMoves().size());
+            g.applyTurn(move.turn);
+            GameState state{g};
+            Game restored{state};
+            REQUIRE(GameState{restored} == state);
+            REQUIRE(restored.getKey() == g.getKey());
+            REQUIRE(restored.getCurrentPlayerIndex() == g.getCurrentPlayerIndex());
+            REQUIRE(restored.getMaze().getPathways() == g.getMaze().getPathways());
+            for (Object object = GHOST; object < NONE; ++object) {
+                REQUIRE(restored.getMaze().getObjectCell(object)
+                        == g.getMaze().getObjectCell(object));
+            }
+            for (unsigned index = 0; index < g.getNbOfPlayers(); ++index) {
+                const Player &expected = g.getPlayer(index);
+                const Player &actual = restored.getPlayer(index);
+                REQUIRE(actual.getNbOfFoundObjectives() == expected.getNbOfFoundObjectives());
+                REQUIRE(actual.getObjective() == expected.getObjective());
+                REQUIRE(restored.getOccupancy().getPlayersAt(expected.getPosition())
+                        == g.getOccupancy().getPlayersAt(expected.getPosition()));
+            }
+            nbOfFoundObjectives += g.getPlayer(0).getNbOfFoundObjectives();
+            if (g.isOver()) break;
+        }
+    }
+    CHECK(nbOfFoundObjectives > 0);
+}
+
+TEST_CASE("The restored game plays on like the original one")
+{
+    Game g{3, false, 21u};
+    Game restored{GameState{g}};
+    for (unsigned turn = 0; turn < 6; ++turn) {
+        MoveGenerator generator{g};
+        Turn next = generator.getMoves().at(turn * 5 % generator.getMoves().size()).turn;
+        CHECK(g.applyTurn(next).hasFoundObjective == restored.applyTurn(next).hasFoundObjective);
+        CHECK(GameState{restored} == GameState{g});
+    }
+}
+
+TEST_CASE("A state with an invalid number of players is rejected")
+{
+    GameState state{Game{2, false, 1u}};
+    state.nbOfPlayers = 5;
+    CHECK_THROWS_AS(Game{state}, std::logic_error);
+}
+
+TEST_CASE("A state with a field out of its range is rejected")
+{
+    const GameState valid{Game{3, false, 2u}};
+    CHECK_NOTHROW(valid.requireValid());
+    std::vector<void (*)(GameState &)> corruptions{
+        [](GameState &state) { state.objects[5] = NONE + 1; },
+        [](GameState &state) { state.spareObject = 200; },
+        [](GameState &state) { state.setShape(3, 0); },
+        [](GameState &state) { state.blockedCell = MazeBitboard::CELLS; },
+        [](GameState &state) { state.selectedInsertionCell = 255; },
+        [](GameState &state) { state.selectedPlayerCell = MazeBitboard::CELLS; },
+        [](GameState &state) { state.currentPlayer = 3; },
+        [](GameState &state) { state.playerCells[2] = MazeBitboard::CELLS; },
+        [](GameState &state) { state.playerStates[1] = 3; },
+        [](GameState &state) { state.nbOfFoundObjectives[0] = 9; },
+        [](GameState &state) { state.objectives[23] = NONE; },
+        [](GameState &state) { state.changedCells = ~Bitboard{0}; },
+    };
+    for (auto corrupt : corruptions) {
+        GameState state = valid;
+        corrupt(state);
+        CHECK_THROWS_AS(state.requireValid(), std::invalid_argument);
+        CHECK_THROWS_AS(Game{state}, std::invalid_argument);
+    }
+}
@@ -6,6 +6,11 @@
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = Maze::SIZE - 1;
+
 TEST_CASE("A player should move the pathways before moving his piece")
 {
     Game g{2};
@@ -32,7 +37,7 @@ TEST_CASE("The current player inserts in the maze without errors")
     Game g{2};
     MazePosition insertion{1, 0};
     MazeCard inserted = g.getCurrentMazeCard();
-    MazeCard ejected = g.getMaze().getCardAt({1, 6});
+    MazeCard ejected = g.getMaze().getCardAt({1, LAST});
     g.selectInsertionPosition(insertion);
     g.movePathWays();
     CHECK(g.getMaze().getCardAt(insertion) == inserted);
@@ -53,7 +58,7 @@ TEST_CASE("The current players plays an entire turn without errors")
     MazePosition insertion{1, 0};
     MazePosition player{g.getCurrentPlayer().getPosition()};
     MazeCard inserted = g.getCurrentMazeCard();
-    MazeCard ejected = g.getMaze().getCardAt({1, 6});
+    MazeCard ejected = g.getMaze().getCardAt({1, LAST});
     g.selectInsertionPosition(insertion);
     g.movePathWays();
     CHECK(g.getMaze().getCardAt(insertion) == inserted);
@@ -145,7 +150,7 @@ TEST_CASE("The current maze card should be the last pushed out mazecard after"
           "movePathWays"){
     Game game{};
     game.selectInsertionPosition(MazePosition{0,1});
-    MazeCard pushedOut = game.getMaze().getCardAt(MazePosition{6,1});
+    MazeCard pushedOut = game.getMaze().getCardAt(MazePosition{LAST,1});
     game.movePathWays();
     CHECK(pushedOut == game.getCurrentMazeCard());
 }
@@ -165,3 +170,40 @@ TEST_CASE("A simplified game is not over when it has no winner")
     Game g{2, true};
     REQUIRE_FALSE(g.isOver());
 }
+
+TEST_CASE("Selecting a position the current player cannot reach causes an error")
+{
+    Game g{2};
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            if (g.getReachablePositions().contains(position)) {
+                g.selectPlayerPosition(position);
+                CHECK(g.getSelectedPlayerPosition() == position);
+            } else {
+                REQUIRE_THROWS_AS(g.selectPlayerPosition(position), std::logic_error);
+            }
+        }
+    }
+}
+
+TEST_CASE("Playing a turn inserts the card, moves the player and passes the hand")
+{
+    Game g{2};
+    MazePosition start = g.getPlayer(0).getPosition();
+    g.playTurn(Turn{MazePosition{0, 1}, 0, start});
+    CHECK(g.getPlayer(0).getPosition() == start);
+    CHECK(g.getPlayer(0).getState() == Player::State::WAITING);
+    CHECK(g.getCurrentPlayerIndex() == 1);
+    REQUIRE_THROWS_AS(g.playTurn(Turn{MazePosition{0, 0}, 0, start}), std::logic_error);
+}
+
+TEST_CASE("Every player starts on his/ her own corner")
+{
+    Game g{4};
+    for (unsigned index = 0; index < g.getNbOfPlayers(); ++index) {
+        const Player &player = g.getPlayer(index);
+        CHECK(player.getPosition() == player.getInitialPosition());
+        CHECK(player.isReturnedToInitialPos());
+    }
+}
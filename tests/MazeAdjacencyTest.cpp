@@ -32,7 +32,7 @@ TEST_CASE("existDirectPathBetween throws an exception if the first position is i
     Maze m;
     MazePosition b{4, 4};
     m.setCardAt(b, MazeCard{UP | DOWN, true});
-    REQUIRE_THROWS_AS(m.existDirectPathBetween(MazePosition{6, 8}, b), std::logic_error);
+    REQUIRE_THROWS_AS(m.existDirectPathBetween(MazePosition{6, Maze::SIZE}, b), std::logic_error);
 }
 
 TEST_CASE("existDirectPathBetween throws an exception if the second position is invalid")
@@ -112,7 +112,7 @@ TEST_CASE("Adjacencies are updated after insertion in left side.")
 TEST_CASE("Adjacencies are updated after insertion in right side.")
 {
     Maze m;
-    m.insertLastPushedOutMazeCardAt(MazePosition{3, 6});
+    m.insertLastPushedOutMazeCardAt(MazePosition{3, Maze::SIZE - 1});
     for (unsigned row = 0; row < Maze::SIZE; ++row) {
         for (unsigned column = 0; column < Maze::SIZE; ++column) {
             MazePosition position{row, column};
@@ -130,7 +130,7 @@ TEST_CASE("Adjacencies are updated after insertion in right side.")
 TEST_CASE("Adjacencies are updated after insertion in down side.")
 {
     Maze m;
-    m.insertLastPushedOutMazeCardAt(MazePosition{6, 3});
+    m.insertLastPushedOutMazeCardAt(MazePosition{Maze::SIZE - 1, 3});
     for (unsigned row = 0; row < Maze::SIZE; ++row) {
         for (unsigned column = 0; column < Maze::SIZE; ++column) {
             MazePosition position{row, column};
@@ -147,5 +147,89 @@ TEST_CASE("Adjacencies are updated after insertion in down side.")
 
 TEST_CASE("If no insertion took place, the maze adjacencies does not update")
 {
+    Maze m;
+    CHECK(m.getLastShiftedCells().empty());
+    CHECK(m.getLastChangedCells().empty());
+}
+
+TEST_CASE("An insertion only reports the shifted line and the relinked cells")
+{
+    Maze m;
+    MazeBitboard before = m.getPathways();
+    m.insertLastPushedOutMazeCardAt(MazePosition{0, 3});
+    CellSet shifted = m.getLastShiftedCells();
+    CHECK(shifted.size() == Maze::SIZE);
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        CHECK(shifted.contains(MazePosition{row, 3}));
+    }
+    CellSet changed = m.getLastChangedCells();
+    CHECK((changed & shifted) == shifted);
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            unsigned cell = MazeBitboard::getCell({row, column});
+            bool relinked = before.getNeighbors(cell)
+                    != m.getPathways().getNeighbors(cell);
+            if (column < 2 || 4 < column) {
+                CHECK_FALSE(changed.contains({row, column}));
+            }
+            if (relinked) {
+                CHECK(changed.contains({row, column}));
+            }
+        }
+    }
+}
+
+TEST_CASE("The pathways updated after an insertion match a full update")
+{
+    Maze m;
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        if (!m.isInserrable(slot)) continue;
+        m.insertLastPushedOutMazeCardAt(slot);
+        MazeBitboard incremental = m.getPathways();
+        m.updateAdjacency();
+        CHECK(incremental == m.getPathways());
+    }
+}
+
+TEST_CASE("The reachable region contains its start and is closed under adjacency")
+{
+    Maze m;
+    MazePosition start{3, 3};
+    CellSet reachable = m.reachableFrom(start);
+    CHECK(reachable.contains(start));
+    for (MazePosition position : reachable) {
+        for (const MazePosition &neighbor : m.getNeighbors(position)) {
+            CHECK(reachable.contains(neighbor));
+        }
+    }
+}
+
+TEST_CASE("The reachable region answers every path query from its start")
+{
+    Maze m;
+    MazePosition start{1, 5};
+    CellSet reachable = m.reachableFrom(start);
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            CHECK(reachable.contains(position) == m.existPathBetween(start, position));
+            CHECK(reachable.contains(position) == m.existPathBetween(position, start));
+        }
+    }
+}
 
+TEST_CASE("The reachable region is limited by walls")
+{
+    Maze m;
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            m.setCardAt(MazePosition{row, column}, MazeCard{LEFT | RIGHT, true});
+        }
+    }
+    m.setCardAt(MazePosition{2, 4}, MazeCard{LEFT | DOWN, true});
+    m.setCardAt(MazePosition{3, 4}, MazeCard{UP | DOWN, true});
+    CellSet reachable = m.reachableFrom(MazePosition{2, 0});
+    CHECK(reachable.size() == 6);
+    CHECK(reachable.contains(MazePosition{3, 4}));
+    CHECK_FALSE(reachable.contains(MazePosition{2, 5}));
 }
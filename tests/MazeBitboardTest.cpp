@@ -0,0 +1,84 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Maze.h"
+#include "MazeBitboard.h"
+#endif
+
+using namespace labyrinth::model;
+
+TEST_CASE("A bitboard keeps the shape set for a cell")
+{
+    MazeBitboard board;
+    board.setShape(17, UP | LEFT);
+    board.setShape(18, RIGHT | DOWN | LEFT);
+    CHECK(board.getShape(17) == (UP | LEFT));
+    CHECK(board.getShape(18) == (RIGHT | DOWN | LEFT));
+    CHECK(board.getShape(16) == 0);
+    board.setShape(17, DOWN);
+    CHECK(board.getShape(17) == DOWN);
+    CHECK_FALSE((board.getOpenings(UP) & MazeBitboard::getBit(17)));
+    CHECK((board.getOpenings(DOWN) & MazeBitboard::getBit(17)));
+}
+
+TEST_CASE("Two cells opened toward each other are linked")
+{
+    MazeBitboard board;
+    board.setShape(MazeBitboard::getCell({3, 3}), RIGHT | DOWN);
+    board.setShape(MazeBitboard::getCell({3, 4}), LEFT);
+    board.setShape(MazeBitboard::getCell({4, 3}), UP);
+    CHECK(board.isLinked(MazeBitboard::getCell({3, 3}), RIGHT));
+    CHECK(board.isLinked(MazeBitboard::getCell({3, 4}), LEFT));
+    CHECK(board.isLinked(MazeBitboard::getCell({3, 3}), DOWN));
+    CHECK(board.isLinked(MazeBitboard::getCell({4, 3}), UP));
+    CHECK(board.getNeighbors(MazeBitboard::getCell({3, 3})) ==
+          (MazeBitboard::getBit(MazeBitboard::getCell({3, 4}))
+           | MazeBitboard::getBit(MazeBitboard::getCell({4, 3}))));
+}
+
+TEST_CASE("Cells on opposite sides of the maze are never linked")
+{
+    MazeBitboard board;
+    for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+        board.setShape(cell, UP | RIGHT | DOWN | LEFT);
+    }
+    CHECK_FALSE(board.isLinked(MazeBitboard::getCell({2, MazeBitboard::SIZE - 1}), RIGHT));
+    CHECK_FALSE(board.isLinked(MazeBitboard::getCell({3, 0}), LEFT));
+    CHECK_FALSE(board.isLinked(MazeBitboard::getCell({0, 3}), UP));
+    CHECK_FALSE(board.isLinked(MazeBitboard::getCell({MazeBitboard::SIZE - 1, 3}), DOWN));
+    CHECK(board.getReachable(MazeBitboard::getBit(0)) == MazeBitboard::ALL);
+}
+
+TEST_CASE("The reachable cells follow the pathways only")
+{
+    MazeBitboard board;
+    board.setShape(MazeBitboard::getCell({0, 0}), RIGHT);
+    board.setShape(MazeBitboard::getCell({0, 1}), LEFT | DOWN);
+    board.setShape(MazeBitboard::getCell({1, 1}), UP | RIGHT);
+    board.setShape(MazeBitboard::getCell({1, 2}), UP);
+    Bitboard expected = MazeBitboard::getBit(MazeBitboard::getCell({0, 0}))
+            | MazeBitboard::getBit(MazeBitboard::getCell({0, 1}))
+            | MazeBitboard::getBit(MazeBitboard::getCell({1, 1}));
+    CHECK(board.getReachable(MazeBitboard::getBit(0)) == expected);
+}
+
+TEST_CASE("The maze pathways match the links of its cards")
+{
+    Maze m;
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            const MazeCard &card = m.getCardAt(position);
+            for (MazeDirection direction = UP; direction <= LEFT; ++direction) {
+                bool expected = false;
+                if (position.hasNeighbor(direction)) {
+                    MazePosition neighbor = position.getNeighbor(direction);
+                    expected = card.isGoing(direction)
+                            && m.getCardAt(neighbor).isGoing(neighbor.getDirectionTo(position));
+                }
+                CHECK(m.getPathways().isLinked(MazeBitboard::getCell(position),
+                                               direction) == expected);
+            }
+        }
+    }
+}
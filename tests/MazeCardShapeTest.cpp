@@ -5,6 +5,9 @@
 #include "MazeCardShape.h"
 #endif
 
+#include <algorithm>
+#include <vector>
+
 using namespace labyrinth::model;
 
 TEST_CASE("MazeCardShape are constructed as the expected shape")
@@ -193,3 +196,67 @@ TEST_CASE("Test of the getShape method"){
     MazeCardShape shape{MazeDirection::UP | MazeDirection::RIGHT | MazeDirection::DOWN};
     CHECK(shape.getValue() == 7);
 }
+
+TEST_CASE("Rotating a shape many quarter turns at once is rotating it one at a time")
+{
+    for (unsigned value = MazeCardShape::MIN_VALUE; value <= MazeCardShape::MAX_VALUE; ++value) {
+        for (unsigned times = 0; times < 8; ++times) {
+            MazeCardShape once{value};
+            MazeCardShape stepped{value};
+            once.rotate(times);
+            for (unsigned i = 0; i < times; ++i) stepped.rotate();
+            CHECK(once == stepped);
+        }
+    }
+}
+
+TEST_CASE("An I shape has 2 distinct orientations, a L or a T shape has 4")
+{
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::DOWN}.getNbOfOrientations() == 2);
+    CHECK(MazeCardShape{MazeDirection::LEFT | MazeDirection::RIGHT}.getNbOfOrientations() == 2);
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::RIGHT}.getNbOfOrientations() == 4);
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::RIGHT
+                        | MazeDirection::DOWN}.getNbOfOrientations() == 4);
+}
+
+TEST_CASE("The distinct orientations of a shape are its first rotations")
+{
+    for (unsigned value = MazeCardShape::MIN_VALUE; value <= MazeCardShape::MAX_VALUE; ++value) {
+        MazeCardShape shape{value};
+        std::vector<unsigned> seen;
+        for (unsigned times = 0; times < 4; ++times) {
+            MazeCardShape rotated = shape;
+            rotated.rotate(times);
+            CHECK(rotated.getCanonicalValue() == shape.getCanonicalValue());
+            CHECK(rotated.getKind() == shape.getKind());
+            if (times < shape.getNbOfOrientations()) {
+                CHECK(std::find(seen.begin(), seen.end(), rotated.getValue()) == seen.end());
+                seen.push_back(rotated.getValue());
+            } else {
+                CHECK(std::find(seen.begin(), seen.end(), rotated.getValue()) != seen.end());
+            }
+        }
+    }
+}
+
+TEST_CASE("A shape is its canonical value rotated by its orientation")
+{
+    for (unsigned value = MazeCardShape::MIN_VALUE; value <= MazeCardShape::MAX_VALUE; ++value) {
+        MazeCardShape shape{value};
+        MazeCardShape canonical{shape.getCanonicalValue()};
+        CHECK(canonical.getOrientation() == 0);
+        CHECK(shape.getOrientation() < shape.getNbOfOrientations());
+        canonical.rotate(shape.getOrientation());
+        CHECK(canonical == shape);
+    }
+}
+
+TEST_CASE("The kind of a shape depends on its directions only")
+{
+    CHECK(MazeCardShape{}.getKind() == MazeCardShape::Kind::NONE);
+    CHECK(MazeCardShape{MazeDirection::LEFT}.getKind() == MazeCardShape::Kind::DEAD_END);
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::DOWN}.getKind() == MazeCardShape::Kind::I);
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::LEFT}.getKind() == MazeCardShape::Kind::L);
+    CHECK(MazeCardShape{MazeDirection::UP | MazeDirection::LEFT
+                        | MazeDirection::RIGHT}.getKind() == MazeCardShape::Kind::T);
+}
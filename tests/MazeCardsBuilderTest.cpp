@@ -2,18 +2,25 @@
 #define CATCH_HPP
 #include "catch.hpp"
 #include "MazeCardsBuilder.h"
+#include "MazeBitboard.h"
 #include <vector>
 #endif
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the number of steady cards, one every other row and column.
+ */
+static const unsigned NB_OF_STEADY_CARDS =
+        (MazeBitboard::SIZE + 1) / 2 * ((MazeBitboard::SIZE + 1) / 2);
+
 TEST_CASE("Steady cards are constructed as expected.")
 {
     MazeCardsBuilder builder;
     std::vector<MazeCard> cards;
     builder.getSteadyCards(cards);
     for (auto const &card : cards) CHECK(!card.isMovable());
-    CHECK(cards.size() == 16);
+    CHECK(cards.size() == NB_OF_STEADY_CARDS);
 }
 
 TEST_CASE("Movable cards are constructed as expected.")
@@ -22,7 +29,7 @@ TEST_CASE("Movable cards are constructed as expected.")
     std::vector<MazeCard> cards;
     builder.getMovableCards(cards);
     for (auto const &card : cards) CHECK(card.isMovable());
-    CHECK(cards.size() == 34);
+    CHECK(cards.size() == MazeBitboard::CELLS + 1 - NB_OF_STEADY_CARDS);
 }
 
 TEST_CASE("The exepcted number of movable T cards is constructed")
@@ -43,7 +50,7 @@ TEST_CASE("The exepcted number of movable I cards is constructed")
     std::vector<MazeCard> cards;
     builder.constructICards(cards);
     for (auto const &card : cards) CHECK(card.isMovable());
-    CHECK(cards.size() == 12);
+    CHECK(cards.size() == (MazeBitboard::SIZE == 7 ? 12 : MazeCardsBuilder::I_CARDS));
 }
 
 TEST_CASE("The exepcted number of movable L cards is constructed")
@@ -52,7 +59,7 @@ TEST_CASE("The exepcted number of movable L cards is constructed")
     std::vector<MazeCard> cards;
     builder.constructLCards(cards);
     for (auto const &card : cards) CHECK(card.isMovable());
-    CHECK(cards.size() == 10);
+    CHECK(cards.size() == (MazeBitboard::SIZE == 7 ? 10 : MazeCardsBuilder::L_CARDS));
 }
 
 TEST_CASE("The exepcted number of marked movable L cards is constructed")
@@ -66,3 +73,15 @@ TEST_CASE("The exepcted number of marked movable L cards is constructed")
     }
     CHECK(cards.size() == 6);
 }
+
+TEST_CASE("There is one card per cell of the maze plus the spare one")
+{
+    MazeCardsBuilder builder;
+    std::vector<MazeCard> cards;
+    builder.getSteadyCards(cards);
+    builder.getMovableCards(cards);
+    CHECK(cards.size() == MazeBitboard::CELLS + 1);
+    unsigned nbOfMarked = 0;
+    for (auto const &card : cards) nbOfMarked += card.isMarked();
+    CHECK(nbOfMarked == 24);
+}
@@ -0,0 +1,64 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "MazeCell.h"
+#include "Player.h"
+#endif
+
+#include <stdexcept>
+
+using namespace labyrinth::model;
+
+TEST_CASE("A cell has the coordinates of its position")
+{
+    for (unsigned index = 0; index < MazeBitboard::CELLS; ++index) {
+        MazeCell cell{index};
+        MazePosition position = MazeBitboard::getPosition(index);
+        REQUIRE(cell.getIndex() == index);
+        REQUIRE(cell.getRow() == position.getRow());
+        REQUIRE(cell.getColumn() == position.getColumn());
+        REQUIRE(cell.getPosition() == position);
+        REQUIRE(MazeCell::of(position) == cell);
+        REQUIRE(cell.getBit() == MazeBitboard::getBit(index));
+    }
+}
+
+TEST_CASE("The neighbors of a cell are the ones of its position")
+{
+    for (unsigned index = 0; index < MazeBitboard::CELLS; ++index) {
+        MazeCell cell{index};
+        MazePosition position = cell.getPosition();
+        for (MazeDirection direction = UP; direction <= LEFT; ++direction) {
+            REQUIRE(cell.hasNeighbor(direction) == position.hasNeighbor(direction));
+            if (cell.hasNeighbor(direction)) {
+                REQUIRE(cell.getNeighbor(direction).getPosition()
+                        == position.getNeighbor(direction));
+            }
+        }
+    }
+}
+
+TEST_CASE("A cell is packed on a single byte and ordered by its index")
+{
+    CHECK(sizeof(MazeCell) == 1);
+    CHECK(MazeCell{} == MazeCell{0});
+    CHECK(MazeCell{3} < MazeCell{4});
+    CHECK(MazeCell{3} != MazeCell{4});
+}
+
+TEST_CASE("A position outside of the maze has no cell")
+{
+    REQUIRE_THROWS_AS(MazeCell::of(MazePosition{MazeBitboard::SIZE, 0}), std::invalid_argument);
+    REQUIRE_THROWS_AS(MazeCell::of(MazePosition{0, MazeBitboard::SIZE}), std::invalid_argument);
+}
+
+TEST_CASE("A player stands on the cell of his position")
+{
+    Player p{Player::Color::GREEN};
+    p.moveTo(2, 5);
+    CHECK(p.getCell() == MazeCell::of(MazePosition{2, 5}));
+    p.setCell(p.getInitialCell());
+    CHECK(p.getPosition() == p.getInitialPosition());
+    CHECK(p.isReturnedToInitialPos());
+    REQUIRE_THROWS_AS(p.setPosition(MazePosition{MazeBitboard::SIZE, 0}), std::invalid_argument);
+}
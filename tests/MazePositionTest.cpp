@@ -2,11 +2,30 @@
 #define CATCH_HPP
 #include "catch.hpp"
 #include <stdexcept>
+#include "MazeBitboard.h"
 #include "MazePosition.h"
 #endif
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = MazeBitboard::SIZE - 1;
+
+TEST_CASE("A coordinate should be smaller than the size of the maze")
+{
+    const unsigned size = MazeBitboard::SIZE;
+    CHECK_NOTHROW(MazePosition{size - 1, size - 1});
+    REQUIRE_THROWS_AS(MazePosition(size, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(MazePosition(0, size), std::invalid_argument);
+    REQUIRE_THROWS_AS(MazePosition(size + 1, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(MazePosition(0, size + 1), std::invalid_argument);
+    MazePosition position;
+    REQUIRE_THROWS_AS(position.moveTo(size, 0), std::invalid_argument);
+    CHECK(position == MazePosition{});
+}
+
 TEST_CASE("Gets the direction to a neighbor to the top")
 {
     MazePosition source{4, 4};
@@ -75,7 +94,7 @@ TEST_CASE("A position on the upper side should not have an upper neighbor")
 
 TEST_CASE("A position on the right side should not have a right neighbor")
 {
-    MazePosition m{4, 6};
+    MazePosition m{4, LAST};
     CHECK(m.hasNeighbor(UP));
     REQUIRE_FALSE(m.hasNeighbor(RIGHT));
     CHECK(m.hasNeighbor(DOWN));
@@ -84,7 +103,7 @@ TEST_CASE("A position on the right side should not have a right neighbor")
 
 TEST_CASE("A position on the down side should not have a down neighbor")
 {
-    MazePosition m{6, 4};
+    MazePosition m{LAST, 4};
     CHECK(m.hasNeighbor(UP));
     CHECK(m.hasNeighbor(RIGHT));
     REQUIRE_FALSE(m.hasNeighbor(DOWN));
@@ -128,7 +147,7 @@ TEST_CASE("Getting the right neighbor of a position should get the expected one"
 
 TEST_CASE("Getting the right neighbor of right side position causes an error")
 {
-    MazePosition m{4, 6};
+    MazePosition m{4, LAST};
     REQUIRE_THROWS_AS(m.getNeighbor(RIGHT), std::invalid_argument);
 }
 
@@ -144,7 +163,7 @@ TEST_CASE("Getting the down neighbor of a position should get the expected one")
 
 TEST_CASE("Getting the down neighbor of down side position causes an error")
 {
-    MazePosition m{6, 4};
+    MazePosition m{LAST, 4};
     REQUIRE_THROWS_AS(m.getNeighbor(DOWN), std::invalid_argument);
 }
 
@@ -10,6 +10,11 @@
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = Maze::SIZE - 1;
+
 #include <iostream>
 
 TEST_CASE("The maze is initialized as expected")
@@ -34,13 +39,13 @@ TEST_CASE("isOnSide should return true when the position is on the up side"){
 
 TEST_CASE("isOnSide should return true when the position is on the right side"){
     Maze maze{};
-    MazePosition position{3, 6};
+    MazePosition position{3, LAST};
     CHECK(maze.isOnSide(position, RIGHT));
 }
 
 TEST_CASE("isOnSide should return true when the position is on the down side"){
     Maze maze{};
-    MazePosition position{6, 3};
+    MazePosition position{LAST, 3};
     CHECK(maze.isOnSide(position, DOWN));
 }
 
@@ -64,13 +69,13 @@ TEST_CASE("isOnASide should return true when the position is on the left side"){
 
 TEST_CASE("isOnASide should return true when the position is on the bottom side"){
     Maze maze{};
-    MazePosition position{6, 4};
+    MazePosition position{LAST, 4};
     CHECK(maze.isOnASide(position));
 }
 
 TEST_CASE("isOnASide should return true when the position is on the right side"){
     Maze maze{};
-    MazePosition position{3, 6};
+    MazePosition position{3, LAST};
     CHECK(maze.isOnASide(position));
 }
 
@@ -83,6 +88,91 @@ TEST_CASE("requireInserrable should cause an error if the position is steady"){
 TEST_CASE("requireInserrable should cause an error if the position is the last push out position"){
     Maze maze{};
     maze.insertLastPushedOutMazeCardAt({1, 0});
-    REQUIRE_THROWS_AS(maze.requireInserrable(MazePosition(1, 6)),
+    REQUIRE_THROWS_AS(maze.requireInserrable(MazePosition(1, LAST)),
                       std::logic_error);
 }
+
+TEST_CASE("Two mazes shuffled with engines of the same seed are the same")
+{
+    RandomEngine first{42};
+    RandomEngine second{42};
+    Maze lhs{first};
+    Maze rhs{second};
+    CHECK(lhs.getKey() == rhs.getKey());
+    CHECK(lhs.getPathways() == rhs.getPathways());
+    CHECK(lhs.getLastPushedOutMazeCard().isEqualTo(rhs.getLastPushedOutMazeCard()));
+    CHECK(first() == second());
+}
+
+TEST_CASE("Mazes shuffled with different seeds are different")
+{
+    RandomEngine first{1};
+    RandomEngine second{2};
+    CHECK(Maze{first}.getKey() != Maze{second}.getKey());
+}
+
+/**
+ * @brief Tells if the object table of the given maze matches its cards.
+ */
+static bool isObjectTableUpToDate(Maze &maze)
+{
+    for (Object object = GHOST; object < NONE; ++object) {
+        unsigned expected = Maze::NO_CELL;
+        for (unsigned row = 0; row < Maze::SIZE; ++row) {
+            for (unsigned column = 0; column < Maze::SIZE; ++column) {
+                if (maze.getCardAt(MazePosition{row, column}).getObject() == object) {
+                    expected = row * Maze::SIZE + column;
+                }
+            }
+        }
+        if (maze.getLastPushedOutMazeCard().getObject() == object) {
+            expected = Maze::SPARE_CELL;
+        }
+        if (maze.getObjectCell(object) != expected) return false;
+    }
+    return true;
+}
+
+TEST_CASE("The cell of every object is known once the maze is initialized")
+{
+    Maze maze;
+    CHECK(isObjectTableUpToDate(maze));
+    for (Object object = GRIMOIRE; object < NONE; ++object) {
+        CHECK(maze.isInside(object));
+        CHECK(maze.getCardAt(maze.getObjectPosition(object)).getObject() == object);
+    }
+}
+
+TEST_CASE("The cells of the objects follow the insertions on every side")
+{
+    Maze maze;
+    for (unsigned round = 0; round < 3; ++round) {
+        for (const MazePosition &slot : Maze::getInsertionSlots()) {
+            if (!maze.isInserrable(slot)) continue;
+            maze.insertLastPushedOutMazeCardAt(slot);
+            REQUIRE(isObjectTableUpToDate(maze));
+        }
+    }
+}
+
+TEST_CASE("The object of the pushed out card is on the spare cell")
+{
+    Maze maze;
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        if (!maze.isInserrable(slot)) continue;
+        MazeCard pushedOut = maze.insertLastPushedOutMazeCardAt(slot);
+        if (pushedOut.getObject() != NONE) {
+            CHECK(maze.getObjectCell(pushedOut.getObject()) == Maze::SPARE_CELL);
+            CHECK_FALSE(maze.isInside(pushedOut.getObject()));
+        }
+    }
+}
+
+TEST_CASE("Setting a card updates the cells of the objects")
+{
+    Maze maze;
+    MazePosition position = maze.getObjectPosition(CROWN);
+    maze.setCardAt(position, maze.getCardAt(MazePosition{0, 1}));
+    CHECK(maze.getObjectCell(CROWN) == Maze::NO_CELL);
+    CHECK(isObjectTableUpToDate(maze));
+}
@@ -0,0 +1,68 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#include "MctsPolicy.h"
+#endif
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+static MctsOptions getOptions(unsigned nbOfPlayouts)
+{
+    MctsOptions options;
+    options.maxNbOfPlayouts = nbOfPlayouts;
+    options.memoryBudget = std::size_t{1} << 20;
+    return options;
+}
+
+TEST_CASE("The MCTS policy chooses a legal turn and leaves the game unchanged")
+{
+    Game g{3, false, 6u};
+    std::uint64_t key = g.getKey();
+    MctsPolicy policy{6, getOptions(200)};
+    CHECK(policy.getName() == "mcts");
+    Turn turn = policy.chooseTurn(g);
+    CHECK(MoveGenerator{g}.isLegal(turn));
+    CHECK(policy.getNbOfPlayouts() == 200);
+    CHECK(policy.getNbOfNodes() > 1);
+    CHECK(g.getKey() == key);
+}
+
+TEST_CASE("The MCTS policy is deterministic for a seed and a playout count")
+{
+    Game g{2, false, 12u};
+    MctsPolicy first{12, getOptions(150)};
+    MctsPolicy second{12, getOptions(150)};
+    CHECK(first.chooseTurn(g) == second.chooseTurn(g));
+}
+
+TEST_CASE("The MCTS policy stops at the deadline")
+{
+    Game g{2, false, 1u};
+    MctsOptions options = getOptions(0);
+    options.maxMilliseconds = 20;
+    MctsPolicy policy{1, options};
+    CHECK(MoveGenerator{g}.isLegal(policy.chooseTurn(g)));
+    CHECK(policy.getNbOfPlayouts() > 0);
+}
+
+TEST_CASE("The tree of the MCTS policy stays within its memory budget")
+{
+    Game g{2, false, 5u};
+    MctsPolicy policy{5, getOptions(3000)};
+    std::size_t capacity = policy.getCapacity();
+    CHECK(MoveGenerator{g}.isLegal(policy.chooseTurn(g)));
+    CHECK(policy.getNbOfPlayouts() == 3000);
+    CHECK(policy.getNbOfNodes() <= capacity);
+    CHECK(policy.getCapacity() == capacity);
+}
+
+TEST_CASE("The settings of the MCTS policy are checked")
+{
+    CHECK_THROWS_AS(MctsPolicy(1, getOptions(0)), std::invalid_argument);
+    MctsOptions options = getOptions(10);
+    options.memoryBudget = 1024;
+    CHECK_THROWS_AS(MctsPolicy(1, options), std::invalid_argument);
+}
@@ -0,0 +1,121 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#endif
+
+using namespace labyrinth::model;
+
+static bool isSameMaze(const Maze &lhs, const Maze &rhs)
+{
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            if (!lhs.getCardAt(position).isEqualTo(rhs.getCardAt(position))
+                    || lhs.getCardAt(position).getObject()
+                    != rhs.getCardAt(position).getObject()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Every slot and rotation is generated at the beginning of a game")
+{
+    Game g{2};
+    MoveGenerator generator{g};
+    CHECK(generator.getShifts().size()
+          == Maze::NB_OF_SLOTS * g.getCurrentMazeCard().getNbOfOrientations());
+}
+
+TEST_CASE("The slot blocked by the last push out position is not generated")
+{
+    Game g{2};
+    g.selectInsertionPosition(MazePosition{3, 0});
+    g.movePathWays();
+    g.selectPlayerPosition(g.getCurrentPlayer().getPosition());
+    g.moveCurrentPlayer();
+    g.nextPlayer();
+    MoveGenerator generator{g};
+    CHECK(generator.getShifts().size()
+          == (Maze::NB_OF_SLOTS - 1) * g.getCurrentMazeCard().getNbOfOrientations());
+    for (const MoveGenerator::Shift &shift : generator.getShifts()) {
+        CHECK_FALSE(shift.insertion == MazePosition(3, Maze::SIZE - 1));
+    }
+}
+
+TEST_CASE("No turn is generated once the current player moved the pathways")
+{
+    Game g{2};
+    g.selectInsertionPosition(MazePosition{3, 0});
+    g.movePathWays();
+    MoveGenerator generator{g};
+    CHECK(generator.getMoves().empty());
+}
+
+TEST_CASE("Generating the turns does not modify the game")
+{
+    Game g{3};
+    Maze before = g.getMaze();
+    MazeCard card = g.getCurrentMazeCard();
+    MoveGenerator generator{g};
+    CHECK(isSameMaze(before, g.getMaze()));
+    CHECK(g.getCurrentMazeCard().isEqualTo(card));
+    CHECK(g.getCurrentPlayer().isWaiting());
+}
+
+TEST_CASE("Every generated turn can be played and leads to its resulting state")
+{
+    Game reference{2};
+    MoveGenerator generator{reference};
+    REQUIRE_FALSE(generator.getMoves().empty());
+    for (unsigned i = 0; i < generator.getMoves().size(); i += 7) {
+        const MoveGenerator::Move &move = generator.getMoves().at(i);
+        const MoveGenerator::Shift &shift = generator.getShiftOf(move);
+        Game g{2};
+        g.getMaze() = reference.getMaze();
+        g.getMaze().getLastPushedOutMazeCard() = reference.getMaze()
+                .getLastPushedOutMazeCard();
+        for (unsigned r = 0; r < move.turn.rotation; ++r) {
+            g.getCurrentMazeCard().rotate();
+        }
+        g.selectInsertionPosition(move.turn.insertion);
+        g.movePathWays();
+        CHECK(isSameMaze(g.getMaze(), shift.maze));
+        for (unsigned p = 0; p < g.getNbOfPlayers(); ++p) {
+            CHECK(g.getPlayer(p).getPosition() == shift.playerPositions.at(p));
+        }
+        g.selectPlayerPosition(move.turn.destination);
+        g.moveCurrentPlayer();
+        CHECK(g.getCurrentPlayer().getPosition() == move.turn.destination);
+    }
+}
+
+TEST_CASE("A turn is legal if and only if the game accepts it")
+{
+    Game g{2, false, 11u};
+    MoveGenerator generator{g};
+    unsigned nbOfRotations = g.getCurrentMazeCard().getNbOfOrientations();
+    for (const MoveGenerator::Move &move : generator.getMoves()) {
+        REQUIRE(generator.isLegal(move.turn));
+        Turn same = move.turn;
+        same.rotation += nbOfRotations;
+        REQUIRE(generator.isLegal(same));
+    }
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        for (unsigned rotation = 0; rotation < 4; ++rotation) {
+            for (unsigned cell = 0; cell < MazeBitboard::CELLS; ++cell) {
+                Turn turn{slot, rotation, MazeBitboard::getPosition(cell)};
+                bool isAccepted = true;
+                try {
+                    g.undoTurn(g.applyTurn(turn));
+                } catch (const std::logic_error &) {
+                    isAccepted = false;
+                }
+                REQUIRE(generator.isLegal(turn) == isAccepted);
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "Occupancy.h"
+#endif
+
+using namespace labyrinth::model;
+
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = Maze::SIZE - 1;
+
+/**
+ * @brief Tells if the occupancy index of the given game matches the positions
+ * of its players.
+ */
+static bool isOccupancyUpToDate(const Game &game)
+{
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            std::uint8_t expected = 0;
+            for (const Player &player : game.getPlayers()) {
+                if (player.getPosition() == position) expected |= 1u << player.getColor();
+            }
+            if (game.getOccupancy().getPlayersAt(position) != expected) return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("An occupancy index keeps one bit per player and per cell")
+{
+    Occupancy occupancy;
+    occupancy.add(Player::RED, MazePosition{1, 2});
+    occupancy.add(Player::GREEN, MazePosition{1, 2});
+    CHECK(occupancy.getPlayersAt(MazePosition{1, 2}) == 0x9);
+    CHECK(occupancy.getOccupiedCells() == MazeBitboard::getBit(MazeBitboard::getCell({1, 2})));
+    occupancy.move(Player::RED, MazePosition{1, 2}, MazePosition{0, 0});
+    CHECK(occupancy.getPlayersAt(MazePosition{1, 2}) == 0x8);
+    CHECK(occupancy.isOccupied(MazePosition{0, 0}));
+    occupancy.remove(Player::GREEN, MazePosition{1, 2});
+    CHECK_FALSE(occupancy.isOccupied(MazePosition{1, 2}));
+    CHECK(occupancy.getOccupiedCells() == MazeBitboard::getBit(0));
+    CHECK(occupancy.getPlayersAt(MazePosition{LAST, LAST}) == 0);
+}
+
+TEST_CASE("The players are indexed on their initial corners")
+{
+    Game g{4};
+    CHECK(isOccupancyUpToDate(g));
+    CHECK(g.getOccupancy().getPlayersAt(MazePosition{0, 0}) == 1u << Player::RED);
+    CHECK(g.getOccupancy().getPlayersAt(MazePosition{LAST, LAST}) == 1u << Player::GREEN);
+    CHECK(g.isAPlayerAt(MazePosition{0, LAST}));
+    CHECK_FALSE(g.isAPlayerAt(MazePosition{3, 3}));
+}
+
+TEST_CASE("The occupancy index follows the players when they are set, shifted and moved")
+{
+    Game g{2};
+    g.getCurrentPlayer().setPosition(MazePosition{1, LAST});
+    CHECK(isOccupancyUpToDate(g));
+    g.selectInsertionPosition(MazePosition{1, 0});
+    g.movePathWays();
+    CHECK(g.getCurrentPlayer().getPosition() == MazePosition{1, 0});
+    CHECK(isOccupancyUpToDate(g));
+    g.selectPlayerPosition(MazePosition{1, 0});
+    g.moveCurrentPlayer();
+    CHECK(isOccupancyUpToDate(g));
+    g.getCurrentPlayer().moveTo(2, 2);
+    CHECK(isOccupancyUpToDate(g));
+    REQUIRE(g.getPlayersAt(MazePosition{2, 2}).size() == 1);
+    CHECK(g.getPlayersAt(MazePosition{2, 2}).at(0).getColor() == Player::RED);
+}
+
+TEST_CASE("A copy of a player is not attached to the occupancy index")
+{
+    Game g{2};
+    Player copy = g.getCurrentPlayer();
+    copy.setPosition(MazePosition{3, 3});
+    CHECK_FALSE(g.isAPlayerAt(MazePosition{3, 3}));
+    CHECK(isOccupancyUpToDate(g));
+}
+
+TEST_CASE("A copy of a game has its own occupancy index")
+{
+    Game g{2};
+    Game copy{g};
+    copy.getCurrentPlayer().setPosition(MazePosition{3, 3});
+    CHECK(copy.isAPlayerAt(MazePosition{3, 3}));
+    CHECK_FALSE(g.isAPlayerAt(MazePosition{3, 3}));
+    CHECK(isOccupancyUpToDate(g));
+    CHECK(isOccupancyUpToDate(copy));
+    CHECK(&copy.getCurrentMazeCard() == &copy.getMaze().getLastPushedOutMazeCard());
+    g = copy;
+    CHECK(g.isAPlayerAt(MazePosition{3, 3}));
+    CHECK(isOccupancyUpToDate(g));
+}
@@ -0,0 +1,49 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#include "PolicyFactory.h"
+#endif
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+TEST_CASE("The policies are constructed by their name")
+{
+    CHECK(PolicyFactory::getPolicy("random", 1)->getName() == "random");
+    CHECK(PolicyFactory::getPolicy("greedy", 1)->getName() == "greedy");
+    CHECK_THROWS_AS(PolicyFactory::getPolicy("unknown", 1), std::invalid_argument);
+}
+
+TEST_CASE("The policies only choose legal turns")
+{
+    Game g{3};
+    auto random = PolicyFactory::getPolicy("random", 7);
+    auto greedy = PolicyFactory::getPolicy("greedy", 7);
+    for (unsigned turn = 0; turn < 12; ++turn) {
+        Policy &policy = turn % 2 == 0 ? *random : *greedy;
+        Turn chosen = policy.chooseTurn(g);
+        REQUIRE(MoveGenerator{g}.isLegal(chosen));
+        g.playTurn(chosen);
+        CHECK(g.getCurrentPlayerIndex() == (turn + 1) % 3);
+    }
+}
+
+TEST_CASE("The greedy policy collects a reachable objective")
+{
+    Game g{2};
+    auto greedy = PolicyFactory::getPolicy("greedy", 3);
+    MoveGenerator generator{g};
+    Object objective = g.getCurrentPlayer().getObjective();
+    bool isReachable = false;
+    for (const MoveGenerator::Move &move : generator.getMoves()) {
+        const Maze &maze = generator.getShiftOf(move).maze;
+        if (maze.getCardAt(move.turn.destination).getObject() == objective) {
+            isReachable = true;
+        }
+    }
+    unsigned before = g.getPlayer(0).getNbOfFoundObjectives();
+    g.playTurn(greedy->chooseTurn(g));
+    CHECK(g.getPlayer(0).getNbOfFoundObjectives() == before + (isReachable ? 1 : 0));
+}
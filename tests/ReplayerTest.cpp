@@ -0,0 +1,113 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "GameRecord.h"
+#include "GreedyPolicy.h"
+#endif
+
+#include <string>
+
+#include "Replayer.h"
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+using namespace labyrinth::replay;
+
+/**
+ * @brief Records the given number of turns of a greedy game of the given seed.
+ */
+static GameRecord recordGame(unsigned seed, unsigned nbOfTurns)
+{
+    Game game{2, false, seed};
+    GameRecord record{2, false, seed};
+    GreedyPolicy policy{seed};
+    for (unsigned turn = 0; turn < nbOfTurns && !game.isOver(); ++turn) {
+        Turn chosen = policy.chooseTurn(game);
+        game.playTurn(chosen);
+        record.addTurn(chosen);
+    }
+    record.finish(game);
+    return record;
+}
+
+static const unsigned char *getBytes(const std::string &bytes)
+{
+    return reinterpret_cast<const unsigned char *>(bytes.data());
+}
+
+TEST_CASE("A recorded game is verified by replaying it")
+{
+    std::string error;
+    CHECK(Replayer::verify(recordGame(3, 20), error));
+    CHECK(error.empty());
+}
+
+TEST_CASE("A record that does not end as the game is not verified")
+{
+    GameRecord record = recordGame(3, 20);
+    record.finish(Game{2, false, 4u});
+    std::string error;
+    CHECK_FALSE(Replayer::verify(record, error));
+    CHECK(error == "the final state does not match the recorded one");
+}
+
+TEST_CASE("A record with an illegal turn is not verified")
+{
+    GameRecord record = recordGame(6, 2);
+    Game replayed = record.createGame();
+    for (const Turn &turn : record.getTurns()) replayed.applyTurn(turn);
+    for (const MazePosition &slot : Maze::getInsertionSlots()) {
+        if (!replayed.getMaze().isInserrable(slot)) {
+            record.addTurn(Turn{slot, 0, MazePosition{0, 0}});
+        }
+    }
+    REQUIRE(record.getTurns().size() == 3);
+    std::string error;
+    CHECK_FALSE(Replayer::verify(record, error));
+    CHECK(error.find("turn 3 is illegal: ") == 0);
+}
+
+TEST_CASE("A file of records is verified the same with any number of threads")
+{
+    std::string bytes;
+    GameRecord::writeFileHeader(bytes);
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        recordGame(seed, 10 * seed).writeTo(bytes);
+    }
+    GameRecord wrongEnd = recordGame(7, 5);
+    wrongEnd.finish(Game{2, false, 8u});
+    wrongEnd.writeTo(bytes);
+    GameState corrupted{Game{2, false, 9u}};
+    corrupted.objects[0] = 200;
+    GameRecord{corrupted}.writeTo(bytes);
+
+    ReplayReport reports[2];
+    unsigned nbOfThreads[2] = {1, 4};
+    for (unsigned index = 0; index < 2; ++index) {
+        ReplayOptions options;
+        options.nbOfThreads = nbOfThreads[index];
+        reports[index] = Replayer{options}.run(getBytes(bytes), getBytes(bytes) + bytes.size());
+        CHECK(reports[index].nbOfGames == 8);
+        CHECK(reports[index].nbOfFailures == 2);
+        CHECK(reports[index].failures.size() == 2);
+    }
+    CHECK(reports[0].nbOfTurns == reports[1].nbOfTurns);
+}
+
+TEST_CASE("Only the first failures are described")
+{
+    std::string bytes;
+    GameRecord::writeFileHeader(bytes);
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        GameRecord record = recordGame(seed, 3);
+        record.finish(Game{3, true, seed});
+        record.writeTo(bytes);
+    }
+    ReplayOptions options;
+    options.nbOfThreads = 2;
+    options.maxNbOfReportedFailures = 3;
+    ReplayReport report = Replayer{options}.run(getBytes(bytes), getBytes(bytes) + bytes.size());
+    CHECK(report.nbOfFailures == 5);
+    CHECK(report.failures.size() == 3);
+}
@@ -0,0 +1,84 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#endif
+
+#include <string>
+
+#include "Session.h"
+
+using namespace labyrinth::model;
+using namespace labyrinth::server;
+
+/**
+ * @brief Tells if the given text ends with the given suffix.
+ */
+static bool endsWith(const std::string &text, const std::string &suffix)
+{
+    return text.size() >= suffix.size()
+            && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+TEST_CASE("A session starts with the maze and the prompt") {
+    Session session{2, false, 7};
+    std::string text = session.start();
+    REQUIRE(text.find("Current mazecard...") != std::string::npos);
+    REQUIRE(endsWith(text, " > "));
+    REQUIRE_FALSE(session.isOver());
+}
+
+TEST_CASE("A session executes the commands of the console") {
+    Session session{2, false, 7};
+    session.start();
+    std::string text = session.execute("rotate 2");
+    REQUIRE(text.find("You have rotated the current maze card 2.") != std::string::npos);
+    REQUIRE(endsWith(text, " > "));
+
+    text = session.execute("insert 0 1");
+    REQUIRE(text.find("Current mazecard...") != std::string::npos);
+    REQUIRE(session.getGame().getCurrentPlayer().isReadyToMove());
+}
+
+TEST_CASE("A session reports the errors of the commands and goes on") {
+    Session session{2, false, 7};
+    session.start();
+    REQUIRE(session.execute("jump 1 2").find("jump is not a command!") != std::string::npos);
+    REQUIRE(session.execute("move").find("usage: move row column") != std::string::npos);
+    REQUIRE(session.execute("  ") == session.execute(""));
+    REQUIRE_FALSE(session.isOver());
+}
+
+TEST_CASE("A session rejects the coordinates outside of the maze") {
+    Session session{2, false, 7};
+    session.start();
+    const std::string size = std::to_string(MazeBitboard::SIZE);
+    for (const std::string &line : {"insert " + size + " 0", "insert 0 " + size,
+                                    std::string{"insert -1 1"}, std::string{"insert 4294967296 1"},
+                                    "move 0 " + size}) {
+        REQUIRE(session.execute(line).find("Invalid coordinate!") != std::string::npos);
+    }
+    REQUIRE(session.getGame().getCurrentPlayer().isWaiting());
+    REQUIRE_FALSE(session.isOver());
+}
+
+TEST_CASE("Passing in a session gives the hand to the next player") {
+    Session session{2, false, 7};
+    session.start();
+    Player::Color first = session.getGame().getCurrentPlayer().getColor();
+    session.execute("insert 0 1");
+    session.execute("pass\r");
+    REQUIRE(session.getGame().getCurrentPlayer().getColor() != first);
+}
+
+TEST_CASE("Exiting a session ends it") {
+    Session session{2, false, 7};
+    session.start();
+    REQUIRE(session.execute("exit") == "Bye!\n");
+    REQUIRE(session.isOver());
+    REQUIRE_THROWS_AS(session.execute("help"), std::logic_error);
+}
+
+TEST_CASE("A session cannot play an unsupported number of players") {
+    REQUIRE_THROWS_AS((Session{5, false, 7}), std::logic_error);
+}
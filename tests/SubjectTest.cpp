@@ -0,0 +1,216 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#endif
+
+#include <stdexcept>
+#include <vector>
+
+using namespace labyrinth::model;
+
+/**
+ * @brief Records the updates it receives.
+ */
+class RecordingObserver : public nvs::Observer
+{
+
+public:
+
+    std::vector<nvs::Changes> updates;
+
+    void update(const nvs::Subject *) override {
+        updates.push_back(nvs::ALL_CHANGES);
+    }
+
+    void update(const nvs::Subject *, nvs::Changes changes) override {
+        updates.push_back(changes);
+    }
+
+};
+
+/**
+ * @brief Counts the updates it receives, without looking at the changes.
+ */
+class CountingObserver : public nvs::Observer
+{
+
+public:
+
+    unsigned nbOfUpdates = 0;
+
+    void update(const nvs::Subject *) override { ++nbOfUpdates; }
+
+};
+
+TEST_CASE("Inserting the current maze card updates the observers once")
+{
+    Game g{2, false, 3u};
+    RecordingObserver observer;
+    g.registerObserver(&observer);
+    MoveGenerator generator{g};
+    g.selectInsertionPosition(generator.getShifts().front().insertion);
+    g.movePathWays();
+    REQUIRE(observer.updates.size() == 1);
+    CHECK(observer.updates.front()
+          == (Game::MAZE_CHANGED | Game::PLAYERS_MOVED | Game::TURN_CHANGED));
+}
+
+TEST_CASE("Asking if a game is over does not update the observers")
+{
+    Game g{2, false, 3u};
+    RecordingObserver observer;
+    g.registerObserver(&observer);
+    CHECK_FALSE(g.isOver());
+    CHECK(observer.updates.empty());
+}
+
+TEST_CASE("Playing a turn updates the observers once with every change")
+{
+    Game g{3, false, 8u};
+    RecordingObserver observer;
+    CountingObserver counter;
+    g.registerObserver(&observer);
+    g.registerObserver(&counter);
+    MoveGenerator generator{g};
+    g.playTurn(generator.getMoves().back().turn);
+    REQUIRE(observer.updates.size() == 1);
+    CHECK((observer.updates.front() & Game::MAZE_CHANGED));
+    CHECK((observer.updates.front() & Game::PLAYERS_MOVED));
+    CHECK((observer.updates.front() & Game::TURN_CHANGED));
+    CHECK(counter.nbOfUpdates == 1);
+}
+
+TEST_CASE("Nested notification batches update the observers when the outer one ends")
+{
+    Game g{2, false, 5u};
+    RecordingObserver observer;
+    g.registerObserver(&observer);
+    {
+        nvs::Subject::Batch outer{g};
+        {
+            nvs::Subject::Batch inner{g};
+            MoveGenerator generator{g};
+            g.playTurn(generator.getMoves().front().turn);
+            inner.commit();
+        }
+        CHECK(observer.updates.empty());
+        MoveGenerator generator{g};
+        g.playTurn(generator.getMoves().front().turn);
+        CHECK(observer.updates.empty());
+        outer.commit();
+    }
+    REQUIRE(observer.updates.size() == 1);
+    CHECK((observer.updates.front() & Game::TURN_CHANGED));
+}
+
+TEST_CASE("A batch without notification does not update the observers")
+{
+    Game g{2, false, 5u};
+    RecordingObserver observer;
+    g.registerObserver(&observer);
+    g.beginNotifications();
+    g.isOver();
+    g.commitNotifications();
+    CHECK(observer.updates.empty());
+    g.commitNotifications();
+    CHECK(observer.updates.empty());
+}
+
+TEST_CASE("A copy of a game does not update the observers of the original")
+{
+    Game g{2, false, 6u};
+    CountingObserver counter;
+    g.registerObserver(&counter);
+    Game copy{g};
+    MoveGenerator generator{copy};
+    copy.playTurn(generator.getMoves().front().turn);
+    CHECK(counter.nbOfUpdates == 0);
+    Game assigned{3, true, 2u};
+    CountingObserver other;
+    assigned.registerObserver(&other);
+    assigned = g;
+    MoveGenerator next{assigned};
+    assigned.playTurn(next.getMoves().front().turn);
+    CHECK(counter.nbOfUpdates == 0);
+    CHECK(other.nbOfUpdates == 1);
+}
+
+TEST_CASE("Applying and undoing turns does not update the observers")
+{
+    unsigned nbOfFoundObjectives = 0;
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        Game g{2, false, seed};
+        CountingObserver counter;
+        g.registerObserver(&counter);
+        MoveGenerator generator{g};
+        for (const MoveGenerator::Move &move : generator.getMoves()) {
+            TurnRecord record = g.applyTurn(move.turn);
+            if (record.hasFoundObjective) ++nbOfFoundObjectives;
+            g.undoTurn(record);
+        }
+        CHECK(counter.nbOfUpdates == 0);
+    }
+    CHECK(nbOfFoundObjectives > 0);
+}
+
+TEST_CASE("Playing an illegal turn leaves the game unchanged and notifies no one")
+{
+    Game g{2, false, 7u};
+    CountingObserver counter;
+    g.registerObserver(&counter);
+    MoveGenerator generator{g};
+    const MoveGenerator::Shift &shift = generator.getShifts().front();
+    unsigned cell = 0;
+    while (shift.destinations.contains(MazeBitboard::getPosition(cell))) ++cell;
+    REQUIRE(cell < MazeBitboard::CELLS);
+    GameState before{g};
+    REQUIRE_THROWS_AS(g.playTurn(Turn{shift.insertion, shift.rotation,
+                                      MazeBitboard::getPosition(cell)}),
+                      std::logic_error);
+    CHECK(GameState{g} == before);
+    CHECK(g.getCurrentPlayer().isWaiting());
+    CHECK(counter.nbOfUpdates == 0);
+}
+
+TEST_CASE("A batch left by an exception does not update the observers")
+{
+    Game g{2, false, 5u};
+    RecordingObserver observer;
+    g.registerObserver(&observer);
+    try {
+        nvs::Subject::Batch batch{g};
+        MoveGenerator generator{g};
+        g.playTurn(generator.getMoves().front().turn);
+        throw std::runtime_error("The batch is left.");
+    } catch (const std::runtime_error &) {
+    }
+    CHECK(observer.updates.empty());
+    MoveGenerator generator{g};
+    g.playTurn(generator.getMoves().front().turn);
+    CHECK(observer.updates.size() == 1);
+}
+
+/**
+ * @brief Throws from every update it receives.
+ */
+class ThrowingObserver : public nvs::Observer
+{
+
+public:
+
+    void update(const nvs::Subject *) override {
+        throw std::runtime_error("The observer failed.");
+    }
+
+};
+
+TEST_CASE("An observer throwing from a committed batch reaches the caller")
+{
+    Game g{2, false, 5u};
+    ThrowingObserver observer;
+    g.registerObserver(&observer);
+    MoveGenerator generator{g};
+    REQUIRE_THROWS_AS(g.playTurn(generator.getMoves().front().turn), std::runtime_error);
+}
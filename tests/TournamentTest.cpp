@@ -0,0 +1,164 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#endif
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Tournament.h"
+
+using namespace labyrinth::sim;
+
+/**
+ * @brief Gets the options of a short tournament between the given entrants.
+ */
+static TournamentOptions getOptions(const std::vector<std::string> &entrants)
+{
+    TournamentOptions options;
+    options.entrants = entrants;
+    options.nbOfRounds = 1;
+    options.nbOfThreads = 1;
+    options.maxNbOfTurns = 1;
+    return options;
+}
+
+/**
+ * @brief Gets the entrants of the given game, sorted.
+ */
+static std::vector<unsigned> getTable(const TournamentGame &game)
+{
+    std::vector<unsigned> table = game.players;
+    std::sort(table.begin(), table.end());
+    return table;
+}
+
+TEST_CASE("A round robin seats every set of entrants once per rotation and rules")
+{
+    TournamentOptions options = getOptions({"random", "greedy", "search", "mcts"});
+    options.nbOfRounds = 2;
+    options.maxNbOfTurns = 0;
+    TournamentReport report = Tournament{options}.run();
+
+    // 6 pairs, 4 triples and 1 table of 4 per round, with each seat first
+    // once per set of rules.
+    REQUIRE(report.games.size() == 2 * 2 * (6 * 2 + 4 * 3 + 1 * 4));
+    std::map<std::vector<unsigned>, unsigned> nbOfGames;
+    std::map<std::vector<unsigned>, unsigned> nbOfFirstMoves;
+    for (unsigned index = 0; index < report.games.size(); ++index) {
+        const TournamentGame &game = report.games[index];
+        CHECK(game.seed == options.seed + index);
+        CHECK(game.round == index / (report.games.size() / 2));
+        CHECK(game.nbOfTurns == 0);
+        CHECK(game.winner == game.players.size());
+        std::vector<unsigned> table = getTable(game);
+        CHECK(std::adjacent_find(table.begin(), table.end()) == table.end());
+        ++nbOfGames[table];
+        std::vector<unsigned> firstMove = table;
+        firstMove.push_back(game.players[0] + (game.isSimplified ? 0 : 4));
+        ++nbOfFirstMoves[firstMove];
+    }
+    CHECK(nbOfGames.size() == 6 + 4 + 1);
+    for (const auto &table : nbOfGames) {
+        CHECK(table.second == 2 * 2 * table.first.size());
+    }
+    for (const auto &firstMove : nbOfFirstMoves) {
+        CHECK(firstMove.second == 2);
+    }
+    for (const Rating &rating : report.ratings) {
+        CHECK(rating.nbOfDraws == rating.nbOfGames);
+        CHECK(rating.elo == Approx(1500));
+    }
+}
+
+TEST_CASE("The player counts above the number of entrants are skipped")
+{
+    TournamentOptions options = getOptions({"random", "greedy"});
+    options.playsFull = false;
+    TournamentReport report = Tournament{options}.run();
+    REQUIRE(report.games.size() == 2);
+    for (const TournamentGame &game : report.games) {
+        CHECK(game.players.size() == 2);
+        CHECK(game.isSimplified);
+    }
+}
+
+TEST_CASE("A swiss round seats the entrants with their neighbors in the ranking")
+{
+    TournamentOptions options = getOptions({"random", "greedy", "search"});
+    options.format = TournamentOptions::Format::SWISS;
+    options.nbOfPlayers = {2};
+    options.playsFull = false;
+    options.maxNbOfTurns = 500;
+    options.nbOfRounds = 3;
+    TournamentReport report = Tournament{options}.run();
+
+    // One table of 2 per round, played once per rotation. The entrant left
+    // over sits out the round.
+    REQUIRE(report.games.size() == 3 * 2);
+    CHECK(getTable(report.games[0]) == (std::vector<unsigned>{0, 1}));
+    for (unsigned round = 1; round < options.nbOfRounds; ++round) {
+        std::vector<double> points(3, 0);
+        for (unsigned index = 0; index < 2 * round; ++index) {
+            const TournamentGame &game = report.games[index];
+            if (game.winner < game.players.size()) {
+                points[game.players[game.winner]] += 1;
+            } else {
+                for (unsigned player : game.players) points[player] += 0.5;
+            }
+        }
+        std::vector<unsigned> table = getTable(report.games[2 * round]);
+        for (unsigned player = 0; player < 3; ++player) {
+            if (std::find(table.begin(), table.end(), player) != table.end()) continue;
+            for (unsigned seated : table) {
+                CHECK(points[player] <= points[seated]);
+            }
+        }
+        CHECK(getTable(report.games[2 * round + 1]) == table);
+    }
+}
+
+TEST_CASE("A tournament gives the same results on 1 thread and on many threads")
+{
+    TournamentOptions options = getOptions({"random", "greedy"});
+    options.nbOfPlayers = {2};
+    options.maxNbOfTurns = 200;
+    options.nbOfRounds = 3;
+    TournamentReport sequential = Tournament{options}.run();
+    options.nbOfThreads = 4;
+    TournamentReport parallel = Tournament{options}.run();
+
+    REQUIRE(parallel.games.size() == sequential.games.size());
+    unsigned nbOfWins = 0;
+    for (unsigned index = 0; index < sequential.games.size(); ++index) {
+        const TournamentGame &lhs = sequential.games[index];
+        const TournamentGame &rhs = parallel.games[index];
+        CHECK(lhs.seed == rhs.seed);
+        CHECK(lhs.players == rhs.players);
+        CHECK(lhs.winner == rhs.winner);
+        CHECK(lhs.nbOfTurns == rhs.nbOfTurns);
+        nbOfWins += lhs.winner < lhs.players.size();
+    }
+    CHECK(nbOfWins > 0);
+    for (unsigned index = 0; index < sequential.ratings.size(); ++index) {
+        CHECK(parallel.ratings[index].elo == sequential.ratings[index].elo);
+        CHECK(parallel.ratings[index].margin == sequential.ratings[index].margin);
+    }
+}
+
+TEST_CASE("A tournament with invalid settings is rejected")
+{
+    REQUIRE_THROWS_AS(Tournament{getOptions({"greedy"})}, std::invalid_argument);
+    REQUIRE_THROWS_AS(Tournament{getOptions({"greedy", "greedy"})}, std::invalid_argument);
+    REQUIRE_THROWS_AS(Tournament{getOptions({"greedy", "unknown"})}, std::invalid_argument);
+    TournamentOptions options = getOptions({"greedy", "random"});
+    options.nbOfPlayers = {5};
+    REQUIRE_THROWS_AS(Tournament{options}, std::invalid_argument);
+    options = getOptions({"greedy", "random"});
+    options.playsSimplified = false;
+    options.playsFull = false;
+    REQUIRE_THROWS_AS(Tournament{options}, std::invalid_argument);
+}
@@ -0,0 +1,80 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#include "TurnSearcher.h"
+#endif
+
+using namespace labyrinth::model;
+using namespace labyrinth::bot;
+
+TEST_CASE("The searcher chooses a legal turn and leaves the game unchanged")
+{
+    Game g{3, false, 4u};
+    std::uint64_t key = g.getKey();
+    TurnSearcher searcher{1, 2, 2};
+    CHECK(searcher.getName() == "search");
+    CHECK(searcher.getNbOfThreads() == 2);
+    SearchResult result = searcher.search(g);
+    CHECK(MoveGenerator{g}.isLegal(result.turn));
+    CHECK(result.nbOfNodes > 0);
+    CHECK(g.getKey() == key);
+}
+
+TEST_CASE("The result of a search does not depend on the number of threads")
+{
+    for (unsigned seed = 0; seed < 3; ++seed) {
+        Game g{2 + seed, false, seed};
+        TurnSearcher single{seed, 2, 1};
+        SearchResult expected = single.search(g);
+        for (unsigned nbOfThreads = 2; nbOfThreads <= 8; nbOfThreads *= 2) {
+            TurnSearcher parallel{seed, 2, nbOfThreads};
+            SearchResult result = parallel.search(g);
+            CHECK(result.turn == expected.turn);
+            CHECK(result.score == expected.score);
+        }
+    }
+}
+
+TEST_CASE("The searcher collects an objective reachable in one turn")
+{
+    unsigned nbOfReachableObjectives = 0;
+    for (unsigned seed = 0; seed < 16; ++seed) {
+        Game g{2, false, seed};
+        MoveGenerator generator{g};
+        Object objective = g.getCurrentPlayer().getObjective();
+        bool isReachable = false;
+        for (const MoveGenerator::Move &move : generator.getMoves()) {
+            const Maze &maze = generator.getShiftOf(move).maze;
+            isReachable = isReachable || (maze.isInside(objective)
+                                          && maze.getObjectPosition(objective)
+                                          == move.turn.destination);
+        }
+        if (!isReachable) continue;
+        ++nbOfReachableObjectives;
+        TurnSearcher searcher{seed, 1, 4};
+        CHECK(g.applyTurn(searcher.search(g).turn).hasFoundObjective);
+    }
+    CHECK(nbOfReachableObjectives > 0);
+}
+
+TEST_CASE("A deeper search scores the answers of the other players")
+{
+    Game g{2, false, 9u};
+    TurnSearcher shallow{9, 1, 4};
+    TurnSearcher deep{9, 2, 4};
+    SearchResult expected = shallow.search(g);
+    SearchResult result = deep.search(g);
+    CHECK(MoveGenerator{g}.isLegal(result.turn));
+    CHECK(result.nbOfNodes > expected.nbOfNodes);
+    CHECK(result.score <= expected.score);
+}
+
+TEST_CASE("A won game is scored as such")
+{
+    Game g{2, true, 2u};
+    g.getCurrentPlayer().turnAllObjectivesOver();
+    CHECK(TurnSearcher::evaluate(g, 0) == TurnSearcher::WIN);
+    CHECK(TurnSearcher::evaluate(g, 1) == -TurnSearcher::WIN);
+}
@@ -0,0 +1,139 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "MoveGenerator.h"
+#endif
+
+#include <vector>
+
+using namespace labyrinth::model;
+
+/**
+ * @brief Tells if the given games are in the same state, cards, players and
+ * objectives included.
+ */
+static bool isSameState(Game &lhs, Game &rhs)
+{
+    if (lhs.getKey() != rhs.getKey()
+            || lhs.getCurrentPlayerIndex() != rhs.getCurrentPlayerIndex()
+            || lhs.getMaze().getPathways() != rhs.getMaze().getPathways()
+            || lhs.getMaze().getLastShiftedCells() != rhs.getMaze().getLastShiftedCells()
+            || lhs.getMaze().getLastChangedCells() != rhs.getMaze().getLastChangedCells()
+            || !(lhs.getSelectedInsertionPosition() == rhs.getSelectedInsertionPosition())
+            || !(lhs.getSelectedPlayerPosition() == rhs.getSelectedPlayerPosition())
+            || !lhs.getCurrentMazeCard().isEqualTo(rhs.getCurrentMazeCard())) {
+        return false;
+    }
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            if (!lhs.getMaze().getCardAt(position).isEqualTo(rhs.getMaze().getCardAt(position))
+                    || lhs.getOccupancy().getPlayersAt(position)
+                    != rhs.getOccupancy().getPlayersAt(position)) {
+                return false;
+            }
+        }
+    }
+    for (Object object = GHOST; object < NONE; ++object) {
+        if (lhs.getMaze().getObjectCell(object) != rhs.getMaze().getObjectCell(object)) {
+            return false;
+        }
+    }
+    for (unsigned index = 0; index < lhs.getNbOfPlayers(); ++index) {
+        const Player &left = lhs.getPlayer(index);
+        const Player &right = rhs.getPlayer(index);
+        if (!(left.getPosition() == right.getPosition())
+                || left.getState() != right.getState()
+                || left.getNbOfFoundObjectives() != right.getNbOfFoundObjectives()
+                || left.getObjective() != right.getObjective()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Applying a turn plays it like playTurn")
+{
+    Game played{3, false, 11u};
+    Game applied{3, false, 11u};
+    MoveGenerator generator{played};
+    Turn turn = generator.getMoves().at(generator.getMoves().size() / 2).turn;
+    bool hasFound = played.playTurn(turn);
+    TurnRecord record = applied.applyTurn(turn);
+    CHECK(record.hasFoundObjective == hasFound);
+    CHECK(isSameState(played, applied));
+}
+
+TEST_CASE("Undoing every turn of the beginning of a game restores it exactly")
+{
+    Game g{2, false, 5u};
+    Game reference{2, false, 5u};
+    MoveGenerator generator{g};
+    for (const MoveGenerator::Move &move : generator.getMoves()) {
+        TurnRecord record = g.applyTurn(move.turn);
+        g.undoTurn(record);
+        REQUIRE(isSameState(g, reference));
+    }
+}
+
+TEST_CASE("Nested turns are undone in the reverse order")
+{
+    Game g{4, false, 17u};
+    Game reference{4, false, 17u};
+    std::vector<TurnRecord> records;
+    std::vector<Game> states;
+    for (unsigned depth = 0; depth < 8; ++depth) {
+        states.push_back(g);
+        MoveGenerator generator{g};
+        records.push_back(g.applyTurn(generator.getMoves().at(depth * 7 % generator.getMoves().size()).turn));
+    }
+    while (!records.empty()) {
+        g.undoTurn(records.back());
+        records.pop_back();
+        REQUIRE(isSameState(g, states.back()));
+        states.pop_back();
+    }
+    CHECK(isSameState(g, reference));
+}
+
+TEST_CASE("Undoing a turn in which an objective was found turns it back")
+{
+    unsigned nbOfFoundObjectives = 0;
+    for (unsigned seed = 0; seed < 16 && nbOfFoundObjectives == 0; ++seed) {
+        Game g{2, false, seed};
+        Game reference{2, false, seed};
+        MoveGenerator generator{g};
+        for (const MoveGenerator::Move &move : generator.getMoves()) {
+            TurnRecord record = g.applyTurn(move.turn);
+            if (record.hasFoundObjective) {
+                CHECK(g.getPlayer(0).getNbOfFoundObjectives() == 1);
+                CHECK(g.getPlayer(0).getObjective() != reference.getPlayer(0).getObjective());
+                ++nbOfFoundObjectives;
+            }
+            g.undoTurn(record);
+            REQUIRE(isSameState(g, reference));
+        }
+    }
+    CHECK(nbOfFoundObjectives > 0);
+}
+
+TEST_CASE("An illegal turn leaves the game unchanged")
+{
+    Game g{2, false, 3u};
+    Game reference{2, false, 3u};
+    REQUIRE_THROWS_AS(g.applyTurn(Turn{MazePosition{0, 0}, 0, MazePosition{0, 0}}),
+                      std::logic_error);
+    CHECK(isSameState(g, reference));
+    MoveGenerator generator{g};
+    const MoveGenerator::Shift &shift = generator.getShifts().front();
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            if (shift.destinations.contains(position)) continue;
+            REQUIRE_THROWS_AS(g.applyTurn(Turn{shift.insertion, shift.rotation, position}),
+                              std::logic_error);
+            REQUIRE(isSameState(g, reference));
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "WorkStealingPool.h"
+#endif
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace labyrinth::bot;
+
+TEST_CASE("A pool runs every submitted task before the wait returns")
+{
+    for (unsigned nbOfThreads = 1; nbOfThreads <= 4; ++nbOfThreads) {
+        WorkStealingPool pool{nbOfThreads};
+        CHECK(pool.getNbOfThreads() == nbOfThreads);
+        std::vector<int> done(100, 0);
+        WorkStealingPool::TaskGroup group;
+        for (unsigned index = 0; index < done.size(); ++index) {
+            pool.submit(group, [&done, index] { done[index] = 1; });
+        }
+        pool.wait(group);
+        CHECK(std::count(done.begin(), done.end(), 1) == 100);
+    }
+}
+
+TEST_CASE("The tasks submitted by a task belong to its group")
+{
+    WorkStealingPool pool{4};
+    std::atomic<unsigned> count{0};
+    WorkStealingPool::TaskGroup group;
+    for (unsigned parent = 0; parent < 10; ++parent) {
+        pool.submit(group, [&] {
+            for (unsigned child = 0; child < 10; ++child) {
+                pool.submit(group, [&] { ++count; });
+            }
+            ++count;
+        });
+    }
+    pool.wait(group);
+    CHECK(count == 110);
+}
+
+TEST_CASE("A pool can be waited for several times")
+{
+    WorkStealingPool pool{3};
+    std::atomic<unsigned> count{0};
+    for (unsigned round = 1; round <= 5; ++round) {
+        WorkStealingPool::TaskGroup group;
+        for (unsigned task = 0; task < 20; ++task) {
+            pool.submit(group, [&] { ++count; });
+        }
+        pool.wait(group);
+        CHECK(count == round * 20);
+    }
+}
+
+TEST_CASE("The exception of a task is thrown by the wait")
+{
+    WorkStealingPool pool{2};
+    std::atomic<unsigned> count{0};
+    WorkStealingPool::TaskGroup group;
+    for (unsigned task = 0; task < 10; ++task) {
+        pool.submit(group, [&, task] {
+            ++count;
+            if (task == 4) throw std::runtime_error("task failed");
+        });
+    }
+    CHECK_THROWS_AS(pool.wait(group), std::runtime_error);
+    CHECK(count == 10);
+}
@@ -0,0 +1,78 @@
+#ifndef CATCH_HPP
+#define CATCH_HPP
+#include "catch.hpp"
+#include "Game.h"
+#include "Zobrist.h"
+#endif
+
+using namespace labyrinth::model;
+
+TEST_CASE("Zobrist keys are stable and distinct")
+{
+    CHECK(Zobrist::getCardKey(3, UP | DOWN, GHOST)
+          == Zobrist::getCardKey(3, UP | DOWN, GHOST));
+    CHECK(Zobrist::getCardKey(3, UP | DOWN, GHOST)
+          != Zobrist::getCardKey(4, UP | DOWN, GHOST));
+    CHECK(Zobrist::getCardKey(3, UP | DOWN, GHOST)
+          != Zobrist::getCardKey(3, LEFT | RIGHT, GHOST));
+    CHECK(Zobrist::getPlayerKey(0, 0) != Zobrist::getPlayerKey(1, 0));
+}
+
+TEST_CASE("A copied maze has the same key as its original")
+{
+    Maze m;
+    Maze copy = m;
+    CHECK(copy.getKey() == m.getKey());
+}
+
+TEST_CASE("Rotating the last pushed out card four times gives back the same key")
+{
+    Maze m;
+    m.getLastPushedOutMazeCard() = MazeCard{UP | RIGHT};
+    std::uint64_t key = m.getKey();
+    m.getLastPushedOutMazeCard().rotate();
+    CHECK(m.getKey() != key);
+    for (unsigned i = 0; i < 3; ++i) m.getLastPushedOutMazeCard().rotate();
+    CHECK(m.getKey() == key);
+}
+
+TEST_CASE("The incremental key matches the key of the same cards set one by one")
+{
+    Maze m;
+    m.insertLastPushedOutMazeCardAt(MazePosition{0, 3});
+    m.insertLastPushedOutMazeCardAt(MazePosition{5, Maze::SIZE - 1});
+    Maze other;
+    for (unsigned row = 0; row < Maze::SIZE; ++row) {
+        for (unsigned column = 0; column < Maze::SIZE; ++column) {
+            MazePosition position{row, column};
+            other.setCardAt(position, m.getCardAt(position));
+        }
+    }
+    other.getLastPushedOutMazeCard() = m.getLastPushedOutMazeCard();
+    CHECK(other.getKey() != m.getKey());
+    other.insertLastPushedOutMazeCardAt(MazePosition{1, 0});
+    m.insertLastPushedOutMazeCardAt(MazePosition{1, 0});
+    CHECK(other.getKey() == m.getKey());
+}
+
+TEST_CASE("Inserting a card changes the key of a game")
+{
+    Game g{2};
+    std::uint64_t key = g.getKey();
+    g.selectInsertionPosition(MazePosition{1, 0});
+    g.movePathWays();
+    CHECK(g.getKey() != key);
+}
+
+TEST_CASE("Moving a player or finding an objective changes the key of a game")
+{
+    Game g{2};
+    std::uint64_t key = g.getKey();
+    g.getCurrentPlayer().setPosition(MazePosition{2, 2});
+    std::uint64_t moved = g.getKey();
+    CHECK(moved != key);
+    g.getCurrentPlayer().turnCurrentObjectiveOver();
+    CHECK(g.getKey() != moved);
+    g.getCurrentPlayer().setPosition(MazePosition{0, 0});
+    CHECK(g.getKey() != key);
+}
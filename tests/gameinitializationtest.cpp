@@ -56,5 +56,28 @@ TEST_CASE("Construct a game with five players causes an error")
     REQUIRE_THROWS_AS(Game{5}, std::logic_error);
 }
 
+TEST_CASE("Two games constructed from the same seed are the same")
+{
+    Game lhs{3, false, 7u};
+    Game rhs{3, false, 7u};
+    CHECK(lhs.getKey() == rhs.getKey());
+    for (unsigned index = 0; index < lhs.getNbOfPlayers(); ++index) {
+        const Player &left = lhs.getPlayer(index);
+        const Player &right = rhs.getPlayer(index);
+        CHECK(left.getObjective() == right.getObjective());
+        auto leftCards = left.getObjectives().getCards();
+        auto rightCards = right.getObjectives().getCards();
+        REQUIRE(leftCards.size() == rightCards.size());
+        for (unsigned card = 0; card < leftCards.size(); ++card) {
+            CHECK(leftCards[card].getObject() == rightCards[card].getObject());
+        }
+    }
+}
 
-
+TEST_CASE("Games constructed with the same random engine are different")
+{
+    RandomEngine engine{7};
+    Game first{2, false, engine};
+    Game second{2, false, engine};
+    CHECK(first.getKey() != second.getKey());
+}
@@ -11,22 +11,27 @@
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = Maze::SIZE - 1;
+
 TEST_CASE("The card is inserted as expected on the upper side"){
     Maze maze{};
     MazeCard inserted = maze.getLastPushedOutMazeCard();
-    MazeCard pushedOut = maze.getCardAt(MazePosition{6, 1});
+    MazeCard pushedOut = maze.getCardAt(MazePosition{LAST, 1});
     MazePosition position{0, 1};
     maze.insertLastPushedOutMazeCardAt(position);
     CHECK(maze.getCardAt(position) == inserted);
     CHECK(maze.getLastPushedOutMazeCard() == pushedOut);
-    CHECK(maze.getLastPushedOutMazePosition() == MazePosition{6, 1});
+    CHECK(maze.getLastPushedOutMazePosition() == MazePosition{LAST, 1});
 }
 
 TEST_CASE("The card is inserted as expected on the down side"){
     Maze maze{};
     MazeCard inserted = maze.getLastPushedOutMazeCard();
     MazeCard pushedOut = maze.getCardAt(MazePosition{0, 1});
-    MazePosition position{6, 1};
+    MazePosition position{LAST, 1};
     maze.insertLastPushedOutMazeCardAt(position);
     CHECK(maze.getCardAt(position) == inserted);
     CHECK(maze.getLastPushedOutMazeCard() == pushedOut);
@@ -36,19 +41,19 @@ TEST_CASE("The card is inserted as expected on the down side"){
 TEST_CASE("The card is inserted as expected on the left side"){
     Maze maze{};
     MazeCard inserted = maze.getLastPushedOutMazeCard();
-    MazeCard pushedOut = maze.getCardAt(MazePosition{3, 6});
+    MazeCard pushedOut = maze.getCardAt(MazePosition{3,LAST});
     MazePosition position{3 ,0};
     maze.insertLastPushedOutMazeCardAt(position);
     CHECK(maze.getCardAt(position) == inserted);
     CHECK(maze.getLastPushedOutMazeCard() == pushedOut);
-    CHECK(maze.getLastPushedOutMazePosition() == MazePosition{3, 6});
+    CHECK(maze.getLastPushedOutMazePosition() == MazePosition{3,LAST});
 }
 
 TEST_CASE("The card is inserted as expected on the right side"){
     Maze maze{};
     MazeCard inserted = maze.getLastPushedOutMazeCard();
     MazeCard pushedOut = maze.getCardAt(MazePosition{1, 0});
-    MazePosition position{1,6};
+    MazePosition position{1,LAST};
     maze.insertLastPushedOutMazeCardAt(position);
     CHECK(maze.getCardAt(position) == inserted);
     CHECK(maze.getLastPushedOutMazeCard() == pushedOut);
@@ -63,12 +68,12 @@ TEST_CASE("The inserting position should be on a maze's side"){
 TEST_CASE("The inserting card should be a movable card"){
     Maze maze{};
     MazeCard insertedMazeCard{};
-    REQUIRE_THROWS(maze.insertLastPushedOutMazeCardAt(MazePosition{0,6}));
+    REQUIRE_THROWS(maze.insertLastPushedOutMazeCardAt(MazePosition{0,LAST}));
 }
 
 TEST_CASE("The returned card should be as expected"){
     Maze maze{};
-    MazePosition position{1,6};
+    MazePosition position{1,LAST};
     MazeCard expectedCard = maze.getCardAt(MazePosition{1,0});
     MazeCard ejectedCard = maze.insertLastPushedOutMazeCardAt(position);
     CHECK(ejectedCard == expectedCard);
@@ -89,7 +94,7 @@ TEST_CASE("All the mazeCards are swapped correctly to the up side"){
 
 TEST_CASE("All the mazeCards are swapped correctly to the down side"){
     Maze maze{};
-    MazePosition position{6,1};
+    MazePosition position{LAST,1};
     std::vector<MazeCard> beforeinsertLastPushedOutMazeCardAt{};
     for(unsigned i{0};i<maze.SIZE-1;++i){
         beforeinsertLastPushedOutMazeCardAt.push_back(maze.getCardAt(MazePosition {i,1}));
@@ -115,7 +120,7 @@ TEST_CASE("All the mazeCards are swapped correctly to the left"){
 
 TEST_CASE("All the mazeCards are swapped correctly to the right"){
     Maze maze{};
-    MazePosition position{1,6};
+    MazePosition position{1,LAST};
     std::vector<MazeCard> beforeinsertLastPushedOutMazeCardAt{};
     for(unsigned i{0};i<maze.SIZE-1;++i){
         beforeinsertLastPushedOutMazeCardAt.push_back(maze.getCardAt(MazePosition {1,i}));
@@ -125,3 +130,31 @@ TEST_CASE("All the mazeCards are swapped correctly to the right"){
         CHECK(beforeinsertLastPushedOutMazeCardAt.at(j) == maze.getCardAt(MazePosition{1,j-1}));
     }
 }
+
+TEST_CASE("All the mazeCards of the column are shifted up when inserting on the down side"){
+    Maze maze{};
+    MazePosition position{LAST,3};
+    std::vector<MazeCard> before{};
+    for(unsigned i{0};i<maze.SIZE;++i){
+        before.push_back(maze.getCardAt(MazePosition{i,3}));
+    }
+    MazeCard neighbor = maze.getCardAt(MazePosition{LAST,4});
+    maze.insertLastPushedOutMazeCardAt(position);
+    for(unsigned j{1};j<maze.SIZE;++j){
+        CHECK(before.at(j) == maze.getCardAt(MazePosition{j-1,3}));
+    }
+    CHECK(maze.getCardAt(MazePosition{LAST,4}) == neighbor);
+}
+
+TEST_CASE("All the mazeCards of the row are shifted left when inserting on the right side"){
+    Maze maze{};
+    MazePosition position{3,LAST};
+    std::vector<MazeCard> before{};
+    for(unsigned i{0};i<maze.SIZE;++i){
+        before.push_back(maze.getCardAt(MazePosition{3,i}));
+    }
+    maze.insertLastPushedOutMazeCardAt(position);
+    for(unsigned j{1};j<maze.SIZE;++j){
+        CHECK(before.at(j) == maze.getCardAt(MazePosition{3,j-1}));
+    }
+}
@@ -6,6 +6,11 @@
 
 using namespace labyrinth::model;
 
+/**
+ * @brief Is the index of the last row and of the last column of the maze.
+ */
+static const unsigned LAST = Maze::SIZE - 1;
+
 TEST_CASE("When inserting a card the player on the same column should be moved"){
     Game game{};
     MazePosition expectedPlayerPosition{1,1};
@@ -27,8 +32,8 @@ TEST_CASE("When inserting a card the player on the same row should be moved."){
 TEST_CASE("The player should be moved to the down side when ejected on the "
           "up side"){
     Game game{};
-    MazePosition expectedPlayerPosition{6,1};
-    game.selectInsertionPosition(MazePosition{6,1});
+    MazePosition expectedPlayerPosition{LAST,1};
+    game.selectInsertionPosition(MazePosition{LAST,1});
     game.getCurrentPlayer().setPosition(MazePosition{0,1});
     game.movePathWays();
     CHECK(game.getCurrentPlayer().getPosition() == expectedPlayerPosition);
@@ -39,7 +44,7 @@ TEST_CASE("The player should be moved to the up side when ejected on the "
     Game game{};
     MazePosition expectedPlayerPosition{0,1};
     game.selectInsertionPosition(MazePosition{0,1});
-    game.getCurrentPlayer().setPosition(MazePosition{6,1});
+    game.getCurrentPlayer().setPosition(MazePosition{LAST,1});
     game.movePathWays();
     CHECK(game.getCurrentPlayer().getPosition() == expectedPlayerPosition);
 }
@@ -49,7 +54,7 @@ TEST_CASE("The player should be moved to the left side when ejected on the "
     Game game{};
     MazePosition expectedPlayerPosition{1,0};
     game.selectInsertionPosition(MazePosition{1,0});
-    game.getCurrentPlayer().setPosition(MazePosition{1,6});
+    game.getCurrentPlayer().setPosition(MazePosition{1,LAST});
     game.movePathWays();
     CHECK(game.getCurrentPlayer().getPosition() == expectedPlayerPosition);
 }
@@ -57,8 +62,8 @@ TEST_CASE("The player should be moved to the left side when ejected on the "
 TEST_CASE("The player should be moved to the right side when ejected on the "
           "left side"){
     Game game{};
-    MazePosition expectedPlayerPosition{1,6};
-    game.selectInsertionPosition(MazePosition{1,6});
+    MazePosition expectedPlayerPosition{1,LAST};
+    game.selectInsertionPosition(MazePosition{1,LAST});
     game.getCurrentPlayer().setPosition(MazePosition{1,0});
     game.movePathWays();
     CHECK(game.getCurrentPlayer().getPosition() == expectedPlayerPosition);
@@ -100,11 +105,11 @@ TEST_CASE("When two players are ejected they should be moved at the opposite "
     Game game{};
     MazePosition expectedPlayerPosition{1,0};
     game.selectInsertionPosition(MazePosition{3,0});
-    game.getCurrentPlayer().setPosition(MazePosition{1,6});
+    game.getCurrentPlayer().setPosition(MazePosition{1,LAST});
     game.movePathWays();
     game.getCurrentPlayer().setDone();
     game.nextPlayer();
-    game.getCurrentPlayer().setPosition(MazePosition{1,6});
+    game.getCurrentPlayer().setPosition(MazePosition{1,LAST});
     game.selectInsertionPosition(MazePosition{1,0});
     game.movePathWays();
     CHECK(game.getPlayers().at(0).getPosition() == expectedPlayerPosition);
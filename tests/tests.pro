@@ -1,7 +1,7 @@
 include(../defaults.pri)
 
 TEMPLATE = app
-CONFIG += console
+CONFIG += console thread
 
 SOURCES += \
     Main.cpp \
@@ -10,35 +10,105 @@ SOURCES += \
     ObjectivesDeckTest.cpp \
     PlayerTest.cpp \
     MazeAdjacencyTest.cpp \
+    MazeBitboardTest.cpp \
+    MazeCellTest.cpp \
+    DistanceFieldTest.cpp \
+    EvaluatorTest.cpp \
+    MoveGeneratorTest.cpp \
     MazeTest.cpp \
     MazePositionTest.cpp \
     MazeCardsBuilderTest.cpp \
     InsertAtTest.cpp \
     GameInitializationTest.cpp \
+    ../core/model/DistanceField.cpp \
     ../core/model/Game.cpp \
+    ../core/model/GameRecord.cpp \
+    ../core/model/GameState.cpp \
     ../core/model/Maze.cpp \
+    ../core/model/MoveGenerator.cpp \
+    ../core/model/MazeBitboard.cpp \
+    ../core/model/MazeCell.cpp \
     ../core/model/mazecard.cpp \
     ../core/model/MazeCardsBuilder.cpp \
     ../core/model/MazeCardShape.cpp \
     ../core/model/MazePosition.cpp \
     ../core/model/ObjectivesDeck.cpp \
+    ../core/model/Zobrist.cpp \
+    ../core/bot/RandomPolicy.cpp \
+    ../core/bot/GreedyPolicy.cpp \
+    ../core/bot/Evaluator.cpp \
+    ../core/bot/TurnSearcher.cpp \
+    ../core/bot/MctsPolicy.cpp \
+    ../core/bot/WorkStealingPool.cpp \
+    ../core/view/console/Frame.cpp \
+    ../core/view/console/Output.cpp \
+    ../core/view/console/View.cpp \
+    ../core/server/Session.cpp \
+    ../core/server/GameServer.cpp \
+    ../replay/Replayer.cpp \
+    ../sim/EloRatings.cpp \
+    ../sim/Tournament.cpp \
     GameTest.cpp \
+    ZobristTest.cpp \
+    PolicyTest.cpp \
+    OccupancyTest.cpp \
+    UndoTurnTest.cpp \
+    SubjectTest.cpp \
+    TurnSearcherTest.cpp \
+    MctsPolicyTest.cpp \
+    WorkStealingPoolTest.cpp \
+    GameStateTest.cpp \
+    GameRecordTest.cpp \
+    ReplayerTest.cpp \
+    EloRatingsTest.cpp \
+    TournamentTest.cpp \
+    FrameTest.cpp \
+    SessionTest.cpp \
+    GameServerTest.cpp \
     Shiftplayertest.cpp \
     ../core/observer/Subject.cpp
 
 HEADERS += \
     catch.hpp \
+    ../core/model/DistanceField.h \
     ../core/model/Game.h \
+    ../core/model/GameRecord.h \
+    ../core/model/GameState.h \
     ../core/model/Maze.h \
+    ../core/model/MoveGenerator.h \
+    ../core/model/Turn.h \
+    ../core/model/TurnRecord.h \
+    ../core/model/CellSet.h \
+    ../core/model/MazeBitboard.h \
+    ../core/model/MazeCell.h \
     ../core/model/MazeCard.h \
     ../core/model/MazeCardsBuilder.h \
     ../core/model/MazeCardShape.h \
     ../core/model/MazeDirection.h \
     ../core/model/MazePosition.h \
+    ../core/model/RandomEngine.h \
     ../core/model/Object.h \
     ../core/model/ObjectCard.h \
     ../core/model/ObjectivesDeck.h \
+    ../core/model/Occupancy.h \
     ../core/model/Player.h \
+    ../core/model/Zobrist.h \
+    ../core/bot/Policy.h \
+    ../core/bot/PolicyFactory.h \
+    ../core/bot/RandomPolicy.h \
+    ../core/bot/GreedyPolicy.h \
+    ../core/bot/Evaluator.h \
+    ../core/bot/TurnSearcher.h \
+    ../core/bot/MctsPolicy.h \
+    ../core/bot/WorkStealingPool.h \
+    ../core/view/console/Frame.h \
+    ../core/view/console/Output.h \
+    ../core/view/console/View.h \
+    ../core/server/Session.h \
+    ../core/server/GameServer.h \
+    ../replay/Replayer.h \
+    ../sim/EloRatings.h \
+    ../sim/Tournament.h \
     ../core/observer/Observer.h \
     ../core/observer/Subject.h
 
@@ -47,3 +117,9 @@ DESTDIR = $$PWD/../build
 INCLUDEPATH += \
     ../core/model \
     ../core/model/model \
+    ../core/bot \
+    ../core/view/console \
+    ../core/controller \
+    ../core/server \
+    ../replay \
+    ../sim \